@@ -0,0 +1,85 @@
+/*********************************************	node_pool bench	*********************************************
+* Compares ft::node_pool with std::allocator on the map's own node type, then the whole
+  build-and-throw-away cycle of small maps (ft::map is pooled, std::map is not).
+* build: c++ -O2 -std=c++98 -I. bench/node_pool.cpp -o node_pool_bench
+**********************************************************************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <map>
+#include <memory>
+#include "includes/map.hpp"
+
+typedef ft::pair<const int, int>	value_type;
+typedef ft::AVLNODE<value_type>		node;
+
+static double seconds(clock_t start)
+{
+	return (static_cast<double>(clock() - start) / CLOCKS_PER_SEC);
+}
+
+// allocate a batch, free it, repeat: what a short-lived map does with its nodes
+static double bench_std_allocator(int rounds, int batch)
+{
+	std::allocator<node>	alloc;
+	node**					nodes = new node*[batch];
+	clock_t					start = clock();
+
+	for (int r = 0; r < rounds; r++)
+	{
+		for (int i = 0; i < batch; i++)
+			nodes[i] = alloc.allocate(1);
+		for (int i = 0; i < batch; i++)
+			alloc.deallocate(nodes[i], 1);
+	}
+	delete[] nodes;
+	return (seconds(start));
+}
+
+static double bench_node_pool(int rounds, int batch)
+{
+	ft::node_pool<node, std::allocator<node> >	pool;
+	node**										nodes = new node*[batch];
+	clock_t										start = clock();
+
+	for (int r = 0; r < rounds; r++)
+	{
+		for (int i = 0; i < batch; i++)
+			nodes[i] = pool.allocate();
+		for (int i = 0; i < batch; i++)
+			pool.deallocate(nodes[i]);
+	}
+	delete[] nodes;
+	return (seconds(start));
+}
+
+template <class Map>
+static double bench_map_churn(int rounds, int batch)
+{
+	clock_t	start = clock();
+	long	sum = 0;
+
+	for (int r = 0; r < rounds; r++)
+	{
+		Map m;
+		for (int i = 0; i < batch; i++)
+			m[(i * 7919) % batch] = i;
+		sum += m.size();
+	}
+	if (sum == 0)
+		std::printf("unexpected\n");
+	return (seconds(start));
+}
+
+int main(int ac, char **av)
+{
+	int rounds	= (ac > 1) ? std::atoi(av[1]) : 200000;
+	int batch	= (ac > 2) ? std::atoi(av[2]) : 32;
+
+	std::printf("%d rounds of %d nodes\n", rounds, batch);
+	std::printf("std::allocator      %.3fs\n", bench_std_allocator(rounds, batch));
+	std::printf("ft::node_pool       %.3fs\n", bench_node_pool(rounds, batch));
+	std::printf("std::map churn      %.3fs\n", bench_map_churn<std::map<int, int> >(rounds, batch));
+	std::printf("ft::map churn       %.3fs\n", bench_map_churn<ft::map<int, int> >(rounds, batch));
+	return (0);
+}
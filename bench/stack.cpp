@@ -0,0 +1,100 @@
+/*********************************************	stack bench	*********************************************
+* ft::stack on its default ft::vector against ft::stack on ft::deque: total time to push then pop n
+  elements, the slowest single push (a vector push that reallocates copies everything), and the peak
+  bytes held by the allocator (old and new buffer coexist while a vector grows).
+* build: c++ -O2 -std=c++98 -I. bench/stack.cpp -o stack_bench
+**********************************************************************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <time.h>
+#include "includes/stack.hpp"
+#include "includes/deque.hpp"
+
+static std::size_t	g_bytes = 0;
+static std::size_t	g_peak = 0;
+
+// std::allocator that keeps count of the bytes it hands out
+template <class T>
+struct counting_allocator : public std::allocator<T>
+{
+	template <class U>
+	struct rebind	{	typedef counting_allocator<U> other;	};
+
+	counting_allocator() {}
+	template <class U>
+	counting_allocator(const counting_allocator<U>&) {}
+
+	T* allocate(std::size_t n, const void* = 0)
+	{
+		g_bytes += n * sizeof(T);
+		if (g_bytes > g_peak)
+			g_peak = g_bytes;
+		return (std::allocator<T>().allocate(n));
+	}
+
+	void deallocate(T* p, std::size_t n)
+	{
+		g_bytes -= n * sizeof(T);
+		std::allocator<T>().deallocate(p, n);
+	}
+};
+
+static double seconds(clock_t start)
+{
+	return (static_cast<double>(clock() - start) / CLOCKS_PER_SEC);
+}
+
+static double now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+template <class Stack>
+static void bench(const char* name, int n, const typename Stack::value_type& val)
+{
+	double	worst = 0;
+
+	g_bytes = 0;
+	g_peak = 0;
+	{
+		Stack	s;
+		clock_t	start = clock();
+
+		for (int i = 0; i < n; i++)
+			s.push(val);
+		while (!s.empty())
+			s.pop();
+		std::printf("%-28s push+pop %.3fs", name, seconds(start));
+	}
+	{
+		Stack	s;
+
+		for (int i = 0; i < n; i++)
+		{
+			double t = now();
+			s.push(val);
+			t = now() - t;
+			if (t > worst)
+				worst = t;
+		}
+	}
+	std::printf("   worst push %8.3fms   peak %7.1fMB\n", worst * 1e3, g_peak / 1048576.0);
+}
+
+int main(int ac, char **av)
+{
+	int n = (ac > 1) ? std::atoi(av[1]) : 4000000;
+
+	std::printf("%d elements\n", n);
+	bench<ft::stack<int, ft::vector<int, counting_allocator<int> > > >("vector<int>", n, 42);
+	bench<ft::stack<int, ft::deque<int, counting_allocator<int> > > >("deque<int>", n, 42);
+	bench<ft::stack<std::string, ft::vector<std::string, counting_allocator<std::string> > > >("vector<string>", n / 4, std::string(40, 'x'));
+	bench<ft::stack<std::string, ft::deque<std::string, counting_allocator<std::string> > > >("deque<string>", n / 4, std::string(40, 'x'));
+	return (0);
+}
@@ -0,0 +1,637 @@
+#ifndef DEQUE_HPP
+#define DEQUE_HPP
+
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+#include "../utlis/deque_iterator.hpp"
+#include "../utlis/reverse_iterator.hpp"
+#include "../utlis/equal.hpp"
+#include "../utlis/type_traits.hpp"
+#include "../utlis/relocate.hpp"
+
+namespace ft
+{
+	/*****************************************	deque	*****************************************
+	* Elements in fixed blocks of about 4KB (see deque_block), found through a map: an array of
+	  block pointers with room left at both ends.
+	* push_back / push_front fill the end block or add one: O(1), nothing already stored moves,
+	  so references and pointers to elements stay valid. When the map runs out of room only the
+	  block pointers are copied, into a bigger map or back to the middle of this one.
+	* One emptied block is kept aside for the next one needed, so pushes and pops going back and
+	  forth over a block boundary do not allocate.
+	* The default constructor allocates nothing.
+	*********************************************************************************************/
+	template <class T, class Allocator = std::allocator<T> >
+	class deque
+	{
+		public:
+			typedef T											value_type;
+			typedef Allocator									allocator_type;
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+			typedef ft::deque_iterator<T>						iterator;
+			typedef ft::deque_iterator<const T>					const_iterator;
+			typedef ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef std::ptrdiff_t								difference_type;
+			typedef std::size_t									size_type;
+
+		private:
+			typedef typename iterator::map_pointer								map_pointer;
+			typedef typename Allocator::template rebind<T*>::other				map_allocator;
+
+			enum {	initial_map_size = 8	};
+
+			map_pointer		_map;
+			size_type		_map_size;
+			iterator		_start;		// first element
+			iterator		_finish;	// one past the last, always inside an allocated block
+			T*				_spare;		// an emptied block kept for reuse, or 0
+			allocator_type	_alloc;
+			map_allocator	_map_alloc;
+
+		public:
+			/*****************	CONSTRUCTORS	******************/
+			explicit deque(const allocator_type& alloc = allocator_type())
+				: _map(0), _map_size(0), _start(), _finish(), _spare(0), _alloc(alloc), _map_alloc(alloc)
+			{}
+
+			explicit deque(size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type())
+				: _map(0), _map_size(0), _start(), _finish(), _spare(0), _alloc(alloc), _map_alloc(alloc)
+			{
+				try
+				{
+					assign(n, val);
+				}
+				catch (...)
+				{
+					release();
+					throw;
+				}
+			}
+
+			template <class InputIterator>
+			deque(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = 0)
+				: _map(0), _map_size(0), _start(), _finish(), _spare(0), _alloc(alloc), _map_alloc(alloc)
+			{
+				try
+				{
+					assign(first, last);
+				}
+				catch (...)
+				{
+					release();
+					throw;
+				}
+			}
+
+			deque(const deque& x)
+				: _map(0), _map_size(0), _start(), _finish(), _spare(0), _alloc(x._alloc), _map_alloc(x._map_alloc)
+			{
+				try
+				{
+					assign(x.begin(), x.end());
+				}
+				catch (...)
+				{
+					release();
+					throw;
+				}
+			}
+
+			deque& operator=(const deque& x)
+			{
+				if (this != &x)
+					assign(x.begin(), x.end());
+				return (*this);
+			}
+
+#if __cplusplus >= 201103L
+			// C++11: the map and blocks change hands
+			deque(deque&& x)
+				: _map(0), _map_size(0), _start(), _finish(), _spare(0), _alloc(x._alloc), _map_alloc(x._map_alloc)
+			{
+				swap(x);
+			}
+
+			deque& operator=(deque&& x)
+			{
+				if (this != &x)
+				{
+					deque tmp(std::move(x));
+					swap(tmp);
+				}
+				return (*this);
+			}
+#endif
+
+			~deque()
+			{
+				release();
+			}
+
+			/*****************	ITERATORS	******************/
+			iterator begin()						{	return (_start);	}
+			const_iterator begin() const			{	return (_start);	}
+			iterator end()							{	return (_finish);	}
+			const_iterator end() const				{	return (_finish);	}
+
+			reverse_iterator rbegin()				{	return (reverse_iterator(end()));			}
+			const_reverse_iterator rbegin() const	{	return (const_reverse_iterator(end()));		}
+			reverse_iterator rend()					{	return (reverse_iterator(begin()));			}
+			const_reverse_iterator rend() const		{	return (const_reverse_iterator(begin()));	}
+
+			/*****************	CAPACITY	******************
+			* shrink_to_fit		frees the spare block; the
+								others only hold elements
+			**************************************************/
+			size_type size() const		{	return (_finish - _start);		}
+			size_type max_size() const	{	return (_alloc.max_size());		}
+			bool empty() const			{	return (_finish == _start);		}
+
+			void resize(size_type n, value_type val = value_type())
+			{
+				while (size() > n)
+					pop_back();
+				while (size() < n)
+					push_back(val);
+			}
+
+			void shrink_to_fit()
+			{
+				if (_spare != 0)
+					_alloc.deallocate(_spare, iterator::block_size());
+				_spare = 0;
+			}
+
+			/*****************	ELEMENT ACCESS	******************/
+			reference operator[](size_type n)				{	return (_start[n]);	}
+			const_reference operator[](size_type n) const	{	return (_start[n]);	}
+
+			reference at(size_type n)
+			{
+				if (n >= size())
+					throw std::out_of_range("deque");
+				return (_start[n]);
+			}
+
+			const_reference at(size_type n) const
+			{
+				if (n >= size())
+					throw std::out_of_range("deque");
+				return (_start[n]);
+			}
+
+			reference front()				{	return (*_start);			}
+			const_reference front() const	{	return (*_start);			}
+			reference back()				{	return (*(_finish - 1));	}
+			const_reference back() const	{	return (*(_finish - 1));	}
+
+			/*****************	MODIFIERS	******************
+			* push / pop at either end		O(1), see above
+			* insert / erase				move the elements on the shorter
+			 								side of pos, then push or pop there
+			**************************************************/
+			void push_back(const value_type& val)
+			{
+				if (_map != 0 && _finish._cur != _finish._last - 1)
+				{
+					_alloc.construct(_finish._cur, val);
+					++_finish._cur;
+					return ;
+				}
+				push_back_block(val);
+			}
+
+			void push_front(const value_type& val)
+			{
+				if (_map != 0 && _start._cur != _start._first)
+				{
+					_alloc.construct(_start._cur - 1, val);
+					--_start._cur;
+					return ;
+				}
+				push_front_block(val);
+			}
+
+#if __cplusplus >= 201103L
+			void push_back(value_type&& val)	{	emplace_back(std::move(val));	}
+			void push_front(value_type&& val)	{	emplace_front(std::move(val));	}
+
+			template <class... Args>
+			void emplace_back(Args&&... args)
+			{
+				if (_map != 0 && _finish._cur != _finish._last - 1)
+				{
+					_alloc.construct(_finish._cur, std::forward<Args>(args)...);
+					++_finish._cur;
+					return ;
+				}
+				push_back_block(std::forward<Args>(args)...);
+			}
+
+			template <class... Args>
+			void emplace_front(Args&&... args)
+			{
+				if (_map != 0 && _start._cur != _start._first)
+				{
+					_alloc.construct(_start._cur - 1, std::forward<Args>(args)...);
+					--_start._cur;
+					return ;
+				}
+				push_front_block(std::forward<Args>(args)...);
+			}
+#endif
+
+			void pop_back()
+			{
+				if (_finish._cur == _finish._first)
+				{
+					free_block(_finish._first);
+					_finish.set_node(_finish._node - 1);
+					_finish._cur = _finish._last;
+				}
+				--_finish._cur;
+				_alloc.destroy(_finish._cur);
+			}
+
+			void pop_front()
+			{
+				_alloc.destroy(_start._cur);
+				if (_start._cur != _start._last - 1)
+					++_start._cur;
+				else
+				{
+					free_block(_start._first);
+					_start.set_node(_start._node + 1);
+					_start._cur = _start._first;
+				}
+			}
+
+			void assign(size_type n, const value_type& val)
+			{
+				clear();
+				for (; n > 0; n--)
+					push_back(val);
+			}
+
+			template <class InputIterator>
+			void assign(InputIterator first, InputIterator last, typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = 0)
+			{
+				clear();
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+
+			iterator insert(iterator position, const value_type& val)
+			{
+				size_type i = position - begin();
+
+				if (i == 0)
+					push_front(val);
+				else if (i == size())
+					push_back(val);
+				else
+					open(i, 1, val);
+				return (begin() + i);
+			}
+
+			// pushing never moves an element, so val is still there for every copy even if it is one of ours
+			void insert(iterator position, size_type n, const value_type& val)
+			{
+				open(position - begin(), n, val);
+			}
+
+			// the range is read once into tmp (it may be single pass, or point into this deque), then moved in
+			template <class InputIterator>
+			void insert(iterator position, InputIterator first, InputIterator last, typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = 0)
+			{
+				size_type	i = position - begin();
+				deque		tmp(first, last, _alloc);
+
+				open(i, tmp);
+			}
+
+			iterator erase(iterator position)
+			{
+				return (erase(position, position + 1));
+			}
+
+			iterator erase(iterator first, iterator last)
+			{
+				size_type i = first - begin();
+				size_type n = last - first;
+
+				if (n == 0)
+					return (first);
+				if (i < (size() - n) / 2)
+				{
+					for (iterator from = first, to = last; from != begin(); )
+						*--to = FT_MOVE(*--from);
+					for (; n > 0; n--)
+						pop_front();
+				}
+				else
+				{
+					for (iterator from = last, to = first; from != end(); ++from, ++to)
+						*to = FT_MOVE(*from);
+					for (; n > 0; n--)
+						pop_back();
+				}
+				return (begin() + i);
+			}
+
+			void swap(deque& x)
+			{
+				std::swap(_map, x._map);
+				std::swap(_map_size, x._map_size);
+				std::swap(_start, x._start);
+				std::swap(_finish, x._finish);
+				std::swap(_spare, x._spare);
+				std::swap(_alloc, x._alloc);
+				std::swap(_map_alloc, x._map_alloc);
+			}
+
+			// keeps the map and the block of begin(), both ends back in its middle
+			void clear()
+			{
+				if (_map == 0)
+					return ;
+				if (!ft::is_trivially_destructible<T>::value)
+					for (iterator it = _start; it != _finish; ++it)
+						_alloc.destroy(it._cur);
+				for (map_pointer node = _start._node + 1; node <= _finish._node; ++node)
+					free_block(*node);
+				_start._cur = _start._first + iterator::block_size() / 2;
+				_finish = _start;
+			}
+
+			allocator_type get_allocator() const	{	return (_alloc);	}
+
+		private:
+			/*****************	BLOCKS AND MAP	******************/
+			T* new_block()
+			{
+				T* block = _spare;
+
+				if (block == 0)
+					return (_alloc.allocate(iterator::block_size()));
+				_spare = 0;
+				return (block);
+			}
+
+			void free_block(T* block)
+			{
+				if (_spare == 0)
+					_spare = block;
+				else
+					_alloc.deallocate(block, iterator::block_size());
+			}
+
+			// first push: a map with one block in its middle, both ends in the middle of the block
+			void init_map()
+			{
+				_map_size = initial_map_size;
+				_map = _map_alloc.allocate(_map_size);
+				try
+				{
+					_map[_map_size / 2] = new_block();
+				}
+				catch (...)
+				{
+					_map_alloc.deallocate(_map, _map_size);
+					_map = 0;
+					throw;
+				}
+				_start = iterator(_map[_map_size / 2] + iterator::block_size() / 2, _map + _map_size / 2);
+				_finish = _start;
+			}
+
+			/*********************************************
+			* room in the map for n more blocks at one end.
+			* the used entries are centred again in this map
+			* when it is less than half full, otherwise in a
+			* new one twice as big (plus n)
+			*********************************************/
+			void reserve_map(size_type n, bool at_front)
+			{
+				if (at_front ? (n <= static_cast<size_type>(_start._node - _map))
+							: (n + 1 <= _map_size - (_finish._node - _map)))
+					return ;
+
+				size_type	used = _finish._node - _start._node + 1;
+				size_type	needed = used + n;
+				map_pointer	start;
+
+				if (_map_size > 2 * needed)
+				{
+					start = _map + (_map_size - needed) / 2 + (at_front ? n : 0);
+					std::memmove(static_cast<void*>(start), static_cast<const void*>(_start._node), used * sizeof(T*));
+				}
+				else
+				{
+					size_type	size = _map_size + std::max(_map_size, n) + 2;
+					map_pointer	map = _map_alloc.allocate(size);
+
+					start = map + (size - needed) / 2 + (at_front ? n : 0);
+					std::memcpy(static_cast<void*>(start), static_cast<const void*>(_start._node), used * sizeof(T*));
+					_map_alloc.deallocate(_map, _map_size);
+					_map = map;
+					_map_size = size;
+				}
+				_start.set_node(start);
+				_finish.set_node(start + used - 1);
+			}
+
+			// the last free slot of the back block is taken: the next block is added now
+#if __cplusplus >= 201103L
+			template <class... Args>
+			void push_back_block(Args&&... args)
+#else
+			void push_back_block(const value_type& val)
+#endif
+			{
+				if (_map == 0)
+				{
+					init_map();
+#if __cplusplus >= 201103L
+					emplace_back(std::forward<Args>(args)...);
+#else
+					push_back(val);
+#endif
+					return ;
+				}
+				reserve_map(1, false);
+				_finish._node[1] = new_block();
+				try
+				{
+#if __cplusplus >= 201103L
+					_alloc.construct(_finish._cur, std::forward<Args>(args)...);
+#else
+					_alloc.construct(_finish._cur, val);
+#endif
+				}
+				catch (...)
+				{
+					free_block(_finish._node[1]);
+					throw;
+				}
+				_finish.set_node(_finish._node + 1);
+				_finish._cur = _finish._first;
+			}
+
+			// the front block is full up to its first slot: a block is added before it
+#if __cplusplus >= 201103L
+			template <class... Args>
+			void push_front_block(Args&&... args)
+#else
+			void push_front_block(const value_type& val)
+#endif
+			{
+				if (_map == 0)
+				{
+					init_map();
+#if __cplusplus >= 201103L
+					emplace_front(std::forward<Args>(args)...);
+#else
+					push_front(val);
+#endif
+					return ;
+				}
+				reserve_map(1, true);
+				_start._node[-1] = new_block();
+				try
+				{
+#if __cplusplus >= 201103L
+					_alloc.construct(_start._node[-1] + iterator::block_size() - 1, std::forward<Args>(args)...);
+#else
+					_alloc.construct(_start._node[-1] + iterator::block_size() - 1, val);
+#endif
+				}
+				catch (...)
+				{
+					free_block(_start._node[-1]);
+					throw;
+				}
+				_start.set_node(_start._node - 1);
+				_start._cur = _start._last - 1;
+			}
+
+			/*********************************************
+			* n new elements at index i: n copies of val are
+			* pushed at the end nearer to i, then rotated in.
+			* a throw pops what was pushed
+			*********************************************/
+			void open(size_type i, size_type n, const value_type& val)
+			{
+				size_type	k = 0;
+				bool		front = i < size() / 2;
+
+				try
+				{
+					if (front)
+					{
+						for (; k < n; k++)
+							push_front(val);
+						std::rotate(begin(), begin() + n, begin() + n + i);
+					}
+					else
+					{
+						for (; k < n; k++)
+							push_back(val);
+						std::rotate(begin() + i, end() - n, end());
+					}
+				}
+				catch (...)
+				{
+					for (; k > 0; k--)
+						front ? pop_front() : pop_back();
+					throw;
+				}
+			}
+
+			// the same with the elements of src, moved: pushed in reverse order at the front
+			void open(size_type i, deque& src)
+			{
+				size_type	n = src.size();
+				size_type	k = 0;
+				bool		front = i < size() / 2;
+
+				try
+				{
+					if (front)
+					{
+						for (iterator it = src.end(); k < n; k++)
+							push_front(FT_MOVE(*--it));
+						std::rotate(begin(), begin() + n, begin() + n + i);
+					}
+					else
+					{
+						for (iterator it = src.begin(); k < n; k++, ++it)
+							push_back(FT_MOVE(*it));
+						std::rotate(begin() + i, end() - n, end());
+					}
+				}
+				catch (...)
+				{
+					for (; k > 0; k--)
+						front ? pop_front() : pop_back();
+					throw;
+				}
+			}
+
+			// everything back to the state of a default constructed deque
+			void release()
+			{
+				if (_map == 0)
+					return ;
+				clear();
+				free_block(_start._first);
+				shrink_to_fit();
+				_map_alloc.deallocate(_map, _map_size);
+				_map = 0;
+				_map_size = 0;
+				_start = iterator();
+				_finish = iterator();
+			}
+	};
+
+	/**************		NON MEMBER FUNC.	***************/
+	template <class T, class Alloc>
+	bool operator==(const deque<T, Alloc>& l, const deque<T, Alloc>& r)
+	{
+		if (l.size() != r.size())
+			return (false);
+		return (ft::equal(l.begin(), l.end(), r.begin()));
+	}
+
+	template <class T, class Alloc>
+	bool operator!=(const deque<T, Alloc>& l, const deque<T, Alloc>& r)	{	return (!(l == r));	}
+
+	template <class T, class Alloc>
+	bool operator<(const deque<T, Alloc>& l, const deque<T, Alloc>& r)
+	{
+		return (ft::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end()));
+	}
+
+	template <class T, class Alloc>
+	bool operator>(const deque<T, Alloc>& l, const deque<T, Alloc>& r)	{	return (r < l);		}
+
+	template <class T, class Alloc>
+	bool operator<=(const deque<T, Alloc>& l, const deque<T, Alloc>& r)	{	return (!(r < l));	}
+
+	template <class T, class Alloc>
+	bool operator>=(const deque<T, Alloc>& l, const deque<T, Alloc>& r)	{	return (!(l < r));	}
+
+	template <class T, class Alloc>
+	void swap(deque<T, Alloc>& x, deque<T, Alloc>& y)
+	{
+		x.swap(y);
+	}
+};
+
+#endif
@@ -0,0 +1,564 @@
+#ifndef FLAT_MAP_HPP
+#define FLAT_MAP_HPP
+
+#include <functional>
+#include <memory>
+#include <algorithm>
+#include "vector.hpp"
+#include "../utlis/pair.hpp"
+#include "../utlis/flat_map_iterator.hpp"
+#include "../utlis/reverse_iterator.hpp"
+#include "../utlis/relocate.hpp"
+#include "../utlis/equal.hpp"
+#include "../utlis/type_traits.hpp"
+
+namespace ft
+{
+
+/*****************************************	flat_map	*****************************************
+* ft::map's interface over two sorted ft::vectors, one of keys and one of mapped values, for tables
+  that are built once and then read many times.
+* A lookup is a binary search through the keys only: no node, no pointer chase, and no space lost
+  to links. For integral keys the search has no data dependent branch and prefetches ahead.
+* Inserting or erasing one element shifts the ones after it: O(n). insert(first, last) sorts the
+  new elements and merges them in a single pass, the way to build or refill the table.
+* Iterators dereference to a pair of references (see flat_map_iterator.hpp); like vector
+  iterators, they are invalidated by any insertion or erasure.
+*************************************************************************************************/
+template <class Key, class T, class Compare = std::less<Key>, class Allocator = std::allocator<pair<const Key, T> > >
+class flat_map
+{
+public:
+    typedef Key                                      key_type;
+    typedef T                                        mapped_type;
+    typedef ft::pair<const key_type, mapped_type>    value_type;
+    typedef Compare                                  key_compare;
+    typedef Allocator                                allocator_type;
+    typedef std::ptrdiff_t                           difference_type;
+    typedef size_t                                   size_type;
+    typedef typename Allocator::template rebind<key_type>::other      key_allocator;
+    typedef typename Allocator::template rebind<mapped_type>::other   mapped_allocator;
+    typedef ft::vector<key_type, key_allocator>                       key_container;
+    typedef ft::vector<mapped_type, mapped_allocator>                 mapped_container;
+    typedef ft::flat_map_iterator<key_type, mapped_type>              iterator;
+    typedef ft::flat_map_iterator<key_type, const mapped_type>        const_iterator;
+    typedef typename iterator::reference             reference;
+    typedef typename const_iterator::reference       const_reference;
+    typedef ft::reverse_iterator<iterator>           reverse_iterator;
+    typedef ft::reverse_iterator<const_iterator>     const_reverse_iterator;
+
+    class value_compare: public std::binary_function<value_type, value_type, bool>
+    {
+        friend class flat_map;
+        protected:
+            Compare comp;
+            value_compare(Compare c) : comp(c) {};
+        public:
+            typedef bool result_type;
+            typedef value_type first_argument_type;
+            typedef value_type second_argument_type;
+            bool operator() (const value_type& x, const value_type& y) const
+            {
+            	return comp(x.first, y.first);
+            }
+    };
+
+	private :
+			key_container		_keys;
+			mapped_container	_values;
+			allocator_type		_alloc;
+			key_compare			_comp;
+
+	public :
+	/*****************	CONSTRUCTORS	******************
+	 * empty
+	 * range		one sort and merge, see insert(first, last)
+	 * copy
+	******************************************************/
+	explicit flat_map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+		: _keys(key_allocator(alloc)), _values(mapped_allocator(alloc)), _alloc(alloc), _comp(comp)
+	{}
+
+	template <class InputIterator>
+	flat_map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+		: _keys(key_allocator(alloc)), _values(mapped_allocator(alloc)), _alloc(alloc), _comp(comp)
+	{
+		this->insert(first, last);
+	}
+
+	flat_map(const flat_map& x) : _keys(x._keys), _values(x._values), _alloc(x._alloc), _comp(x._comp) {}
+
+	flat_map& operator=(const flat_map& x)
+	{
+		if (this != &x)
+		{
+			_keys	= x._keys;
+			_values	= x._values;
+			_alloc	= x._alloc;
+			_comp	= x._comp;
+		}
+		return (*this);
+	}
+
+#if __cplusplus >= 201103L
+	flat_map(flat_map&& x) noexcept : _keys(std::move(x._keys)), _values(std::move(x._values)), _alloc(x._alloc), _comp(x._comp) {}
+
+	flat_map& operator=(flat_map&& x) noexcept
+	{
+		if (this != &x)
+		{
+			_keys	= std::move(x._keys);
+			_values	= std::move(x._values);
+			_alloc	= x._alloc;
+			_comp	= x._comp;
+		}
+		return (*this);
+	}
+#endif
+
+	~flat_map() {}
+
+	/*****************	ITERATOR	*********************/
+	iterator begin()						{	return (iterator(_keys.data(), _values.data()));						}
+	const_iterator begin() const			{	return (const_iterator(_keys.data(), _values.data()));					}
+
+	iterator end()							{	return (begin() + _keys.size());	}
+	const_iterator end() const				{	return (begin() + _keys.size());	}
+
+	reverse_iterator rbegin()				{	return (reverse_iterator(end()));			}
+	const_reverse_iterator rbegin() const	{	return (const_reverse_iterator(end()));		}
+
+	reverse_iterator rend()					{	return (reverse_iterator(begin()));			}
+	const_reverse_iterator rend() const		{	return (const_reverse_iterator(begin()));	}
+
+	/******************	CAPACITY	********************
+	 * reserve / shrink_to_fit		act on both arrays
+	******************************************************/
+	bool empty() const			{	return (_keys.empty());		}
+	size_type size() const		{	return (_keys.size());		}
+	size_type max_size() const	{	return (std::min(_keys.max_size(), _values.max_size()));	}
+
+	void reserve(size_type n)
+	{
+		_keys.reserve(n);
+		_values.reserve(n);
+	}
+
+	void shrink_to_fit()
+	{
+		_keys.shrink_to_fit();
+		_values.shrink_to_fit();
+	}
+
+	/******************	ELEMENT ACCESS	********************
+	 * operator[]		inserts a default mapped value if k is absent
+	 * keys / values	the sorted arrays themselves, read only
+	******************************************************/
+	mapped_type& operator[](const key_type& k)
+	{
+		size_type i = search<false>(k);
+
+		if (!found(i, k))
+			insert_at(i, k, mapped_type());
+		return (_values[i]);
+	}
+
+	const key_container& keys() const		{	return (_keys);		}
+	const mapped_container& values() const	{	return (_values);	}
+
+	/******************	MODIFIER	********************
+	 * insert			single element, with hint, range
+	 * try_emplace		inserts (k, obj) only if k is absent
+	 * insert_or_assign	inserts (k, obj) or assigns obj to the existing mapped value
+	 * erase
+	 * swap
+	 * clear
+	******************************************************/
+	ft::pair<iterator,bool> insert(const value_type& x)
+	{
+		return (try_emplace(x.first, x.second));
+	}
+
+	// the hint is taken when x goes right before it, a check of two keys
+	iterator insert(iterator position, const value_type& x)
+	{
+		size_type i = position - begin();
+
+		if ((i == 0 || _comp(_keys[i - 1], x.first)) && (i == size() || _comp(x.first, _keys[i])))
+		{
+			insert_at(i, x.first, x.second);
+			return (begin() + i);
+		}
+		return (insert(x).first);
+	}
+
+	/*********************************************
+	* the new elements are gathered and stably sorted
+	* (unless already in order), then merged with the
+	* table in one pass: O(n + m log m) for m new ones.
+	* as with m single inserts, a key already present,
+	* or seen earlier in the range, keeps its value
+	*********************************************/
+	template <class InputIterator>
+	void insert(InputIterator first, InputIterator last)
+	{
+		typedef ft::pair<key_type, mapped_type>										entry;
+		typedef typename Allocator::template rebind<entry>::other					entry_allocator;
+		ft::vector<entry, entry_allocator>	in((entry_allocator(_alloc)));
+
+		for (; first != last; ++first)
+			in.push_back(entry((*first).first, (*first).second));
+		if (in.empty())
+			return ;
+
+		entry*			a = in.data();
+		entry*			b = a + in.size();
+		entry_less		less(_comp);
+
+		for (entry* p = a + 1; p != b; ++p)
+			if (less(*p, *(p - 1)))
+			{
+				std::stable_sort(a, b, less);
+				break ;
+			}
+		if (empty() || _comp(_keys.back(), a->first))
+			return (append(a, b));
+		merge(a, b);
+	}
+
+#if __cplusplus >= 201103L
+	ft::pair<iterator,bool> insert(value_type&& x)
+	{
+		size_type i = search<false>(x.first);
+
+		if (found(i, x.first))
+			return (ft::make_pair(begin() + i, false));
+		insert_at(i, x.first, std::move(x.second));
+		return (ft::make_pair(begin() + i, true));
+	}
+#endif
+
+	ft::pair<iterator,bool> try_emplace(const key_type& k, const mapped_type& obj = mapped_type())
+	{
+		size_type i = search<false>(k);
+
+		if (found(i, k))
+			return (ft::make_pair(begin() + i, false));
+		insert_at(i, k, obj);
+		return (ft::make_pair(begin() + i, true));
+	}
+
+	ft::pair<iterator,bool> insert_or_assign(const key_type& k, const mapped_type& obj)
+	{
+		ft::pair<iterator,bool> res = try_emplace(k, obj);
+
+		if (!res.second)
+			res.first->second = obj;
+		return (res);
+	}
+
+	void erase(iterator position)
+	{
+		size_type i = position - begin();
+
+		_keys.erase(_keys.begin() + i);
+		_values.erase(_values.begin() + i);
+	}
+
+	size_type erase(const key_type& k)
+	{
+		size_type i = search<false>(k);
+
+		if (!found(i, k))
+			return (0);
+		erase(begin() + i);
+		return (1);
+	}
+
+	void erase(iterator first, iterator last)
+	{
+		size_type i = first - begin();
+		size_type j = last - begin();
+
+		_keys.erase(_keys.begin() + i, _keys.begin() + j);
+		_values.erase(_values.begin() + i, _values.begin() + j);
+	}
+
+	void swap(flat_map& x)
+	{
+		_keys.swap(x._keys);
+		_values.swap(x._values);
+		std::swap(_alloc, x._alloc);
+		std::swap(_comp, x._comp);
+	}
+
+	void clear()
+	{
+		_keys.clear();
+		_values.clear();
+	}
+
+	/******************	OBSERVERS	********************/
+	key_compare key_comp() const		{	return (_comp);					}
+	value_compare value_comp() const	{	return (value_compare(_comp));	}
+
+	allocator_type get_allocator() const	{	return (_alloc);	}
+
+	/******************	MAP OPERATIONS	********************
+	 * all of them are one binary search over the keys
+	******************************************************/
+	iterator find(const key_type& k)
+	{
+		size_type i = search<false>(k);
+		return (found(i, k) ? begin() + i : end());
+	}
+
+	const_iterator find(const key_type& k) const
+	{
+		size_type i = search<false>(k);
+		return (found(i, k) ? begin() + i : end());
+	}
+
+	size_type count(const key_type& k) const
+	{
+		return (found(search<false>(k), k));
+	}
+
+	iterator lower_bound(const key_type& k)					{	return (begin() + search<false>(k));	}
+	const_iterator lower_bound(const key_type& k) const		{	return (begin() + search<false>(k));	}
+
+	iterator upper_bound(const key_type& k)					{	return (begin() + search<true>(k));		}
+	const_iterator upper_bound(const key_type& k) const		{	return (begin() + search<true>(k));		}
+
+	ft::pair<iterator,iterator> equal_range(const key_type& k)
+	{
+		iterator it = lower_bound(k);
+		return (ft::make_pair(it, (it != end() && !_comp(k, it->first)) ? it + 1 : it));
+	}
+
+	ft::pair<const_iterator,const_iterator> equal_range(const key_type& k) const
+	{
+		const_iterator it = lower_bound(k);
+		return (ft::make_pair(it, (it != end() && !_comp(k, it->first)) ? it + 1 : it));
+	}
+
+	private :
+	struct entry_less
+	{
+		Compare comp;
+		entry_less(const Compare& c) : comp(c) {}
+		template <class E>
+		bool operator()(const E& x, const E& y) const	{	return (comp(x.first, y.first));	}
+	};
+
+	// x goes before k: lower_bound (not after k: upper_bound)
+	template <bool Upper>
+	bool before(const key_type& x, const key_type& k) const
+	{
+		return (Upper ? !_comp(k, x) : _comp(x, k));
+	}
+
+	/*********************************************
+	* index of the first key that x does not go before.
+	* integral keys: the range is halved with a select,
+	  not a jump, so the loop runs log n times with no
+	  mispredicted branch; the two keys the next step
+	  may look at are prefetched meanwhile.
+	* other keys: comparing costs more than a missed
+	  branch, the classic search stops no later
+	*********************************************/
+	template <bool Upper>
+	size_type search(const key_type& k) const
+	{
+		const key_type*	base = _keys.data();
+		size_type		n = _keys.size();
+
+		if (n == 0)
+			return (0);
+		if (!ft::is_integral<key_type>::value)
+		{
+			size_type lo = 0;
+
+			while (n > 0)
+			{
+				size_type half = n / 2;
+				if (before<Upper>(base[lo + half], k))
+				{
+					lo += half + 1;
+					n -= half + 1;
+				}
+				else
+					n = half;
+			}
+			return (lo);
+		}
+		while (n > 1)
+		{
+			size_type half = n / 2;
+#if defined(__GNUC__)
+			__builtin_prefetch(base + half / 2);
+			__builtin_prefetch(base + half + half / 2);
+#endif
+			base = before<Upper>(base[half], k) ? base + half : base;
+			n -= half;
+		}
+		return ((base - _keys.data()) + before<Upper>(*base, k));
+	}
+
+	bool found(size_type i, const key_type& k) const
+	{
+		return (i < _keys.size() && !_comp(k, _keys[i]));
+	}
+
+	// both arrays or neither
+	template <class M>
+	void insert_at(size_type i, const key_type& k, const M& v)
+	{
+		_keys.insert(_keys.begin() + i, k);
+		try
+		{
+			_values.insert(_values.begin() + i, v);
+		}
+		catch (...)
+		{
+			_keys.erase(_keys.begin() + i);
+			throw;
+		}
+	}
+
+#if __cplusplus >= 201103L
+	void insert_at(size_type i, const key_type& k, mapped_type&& v)
+	{
+		_keys.insert(_keys.begin() + i, k);
+		try
+		{
+			_values.insert(_values.begin() + i, std::move(v));
+		}
+		catch (...)
+		{
+			_keys.erase(_keys.begin() + i);
+			throw;
+		}
+	}
+#endif
+
+	// sorted [a, b) all after the last key: no merge needed. both arrays or neither, as in insert_at
+	template <class E>
+	void append(E* a, E* b)
+	{
+		reserve(size() + (b - a));
+		for (; a != b; ++a)
+			if (empty() || _comp(_keys.back(), a->first))
+			{
+				_keys.push_back(a->first);
+				try
+				{
+					_values.push_back(FT_MOVE(a->second));
+				}
+				catch (...)
+				{
+					_keys.pop_back();
+					throw;
+				}
+			}
+	}
+
+	/*********************************************
+	* one pass over both sorted sequences into new
+	* arrays, existing keys first, swapped in at the
+	* end. on a throw the existing values moved so
+	* far are moved back: the map is left as it was
+	*********************************************/
+	template <class E>
+	void merge(E* a, E* b)
+	{
+		key_container		keys(_keys.get_allocator());
+		mapped_container	values(_values.get_allocator());
+		size_type			i = 0;
+		size_type			n = size();
+
+		keys.reserve(n + (b - a));
+		values.reserve(n + (b - a));
+		try
+		{
+			while (i < n || a != b)
+			{
+				if (a == b || (i < n && !_comp(a->first, _keys[i])))
+				{
+					keys.push_back(_keys[i]);
+					values.push_back(FT_MOVE(_values[i]));
+					i++;
+				}
+				else
+				{
+					if (keys.empty() || _comp(keys.back(), a->first))
+					{
+						keys.push_back(a->first);
+						values.push_back(FT_MOVE(a->second));
+					}
+					++a;
+				}
+			}
+		}
+		catch (...)
+		{
+#if __cplusplus >= 201103L
+			// keys are unique in keys: _keys[0, i) turn up in it in order
+			for (size_type j = 0, k = 0; k < i && j < values.size(); j++)
+				if (!_comp(keys[j], _keys[k]) && !_comp(_keys[k], keys[j]))
+					_values[k++] = std::move(values[j]);
+#endif
+			throw;
+		}
+		_keys.swap(keys);
+		_values.swap(values);
+	}
+};
+
+	/******************	NON MEMBER FUNC.	********************
+	 * == compares the two arrays on their own, see ft::equal
+	******************************************************/
+	template <class Key, class T, class Compare, class Allocator>
+	bool operator== ( const flat_map<Key,T,Compare,Allocator>& lhs, const flat_map<Key,T,Compare,Allocator>& rhs )
+	{
+		return (lhs.keys() == rhs.keys() && lhs.values() == rhs.values());
+	}
+
+	template <class Key, class T, class Compare, class Allocator>
+	bool operator!= ( const flat_map<Key,T,Compare,Allocator>& lhs, const flat_map<Key,T,Compare,Allocator>& rhs )
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class T, class Compare, class Allocator>
+	bool operator<  ( const flat_map<Key,T,Compare,Allocator>& lhs, const flat_map<Key,T,Compare,Allocator>& rhs )
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class Key, class T, class Compare, class Allocator>
+	bool operator> ( const flat_map<Key,T,Compare,Allocator>& lhs, const flat_map<Key,T,Compare,Allocator>& rhs )
+	{
+		return (rhs < lhs);
+	}
+
+	template <class Key, class T, class Compare, class Allocator>
+	bool operator>= ( const flat_map<Key,T,Compare,Allocator>& lhs, const flat_map<Key,T,Compare,Allocator>& rhs )
+	{
+		return (!(lhs < rhs));
+	}
+
+	template <class Key, class T, class Compare, class Allocator>
+	bool operator<= ( const flat_map<Key,T,Compare,Allocator>& lhs, const flat_map<Key,T,Compare,Allocator>& rhs )
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class Key, class T, class Compare, class Allocator>
+	void swap (flat_map<Key,T,Compare,Allocator>& x, flat_map<Key,T,Compare,Allocator>& y)
+	{
+		x.swap(y);
+	}
+};
+
+#endif
@@ -3,8 +3,9 @@
 
 #include <functional>
 #include <memory>
-#include <vector>
+#include <algorithm>
 #include <iostream> 
+#include <utility>
 #include "../utlis/pair.hpp"
 #include "../utlis/avl.hpp"
 #include "../utlis/equal.hpp"
@@ -29,7 +30,7 @@ public:
     typedef typename allocator_type::const_pointer   const_pointer;
     typedef std::ptrdiff_t                           difference_type;
     typedef size_t                                   size_type;
-    typedef ft::AVL<value_type, Compare, Allocator>  tree;
+    typedef ft::AVL<key_type, value_type, ft::select_first<value_type>, Compare, Allocator>  tree;
     typedef typename tree::iterator             	 iterator;
     typedef typename tree::const_iterator       	 const_iterator;
     typedef typename tree::reverse_iterator       	 reverse_iterator;
@@ -63,30 +64,45 @@ public:
 	 * copy
 	 * destructor
 	******************************************************/
-	explicit map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _alloc(alloc), _comp(comp)
+	explicit map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _avl(comp, alloc), _alloc(alloc), _comp(comp)
 	{}
     
+	// sorted input is built in linear time, see AVL::insert_range
 	template <class InputIterator>
-	map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _alloc(alloc), _comp(comp)
+	map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _avl(comp, alloc), _alloc(alloc), _comp(comp)
 	{
 		this->insert(first, last);
 	}
 
-	map(const map& x): _alloc(x._alloc), _comp(x._comp) {
-		this->insert(x.begin(), x.end());
-	}
+	// linear copy of an already balanced, sorted tree
+	map(const map& x): _avl(x._avl), _alloc(x._alloc), _comp(x._comp) {}
 
 	map& operator=(const map& x)
 	{
-		clear();
 		if (this != &x)
 		{
+			_avl	= x._avl;
+			_alloc	= x._alloc;
+			_comp	= x._comp;
+		}
+		return (*this);
+	}
+
+#if __cplusplus >= 201103L
+	// C++11: the tree is taken over, no node is copied
+	map(map&& x) noexcept : _avl(std::move(x._avl)), _alloc(x._alloc), _comp(x._comp) {}
+
+	map& operator=(map&& x) noexcept
+	{
+		if (this != &x)
+		{
+			_avl	= std::move(x._avl);
 			_alloc	= x._alloc;
 			_comp	= x._comp;
 		}
-		this->insert(x.begin(), x.end());
 		return (*this);
 	}
+#endif
 
 	~map() {
 		_avl.clear();
@@ -130,13 +146,20 @@ public:
 	******************************************************/
     mapped_type& operator[](const key_type& x)
 	{
-		if (_avl.find(x) == 0)
-			return  ((insert(ft::make_pair(x,mapped_type())).first)->second);
-		return (_avl.find(x)->_data->second);
+		return (_avl.find_or_insert(x).first->_data.second);
+	}
+
+#if __cplusplus >= 201103L
+    mapped_type& operator[](key_type&& x)
+	{
+		return (_avl.try_emplace(std::move(x)).first->_data.second);
 	}
+#endif
 
     /******************	MODIFIER	********************
 	 * insert
+	 * try_emplace
+	 * insert_or_assign
 	 * erase
 	 * swap
 	 * clear
@@ -151,31 +174,118 @@ public:
 
 	ft::pair<iterator,bool> insert(const value_type& x)
 	{
-        bool sec = _avl.insert(x);
-        iterator first = iterator(_avl.find(x.first), &_avl);
-        ft::pair<iterator, bool> ret = ft::make_pair(first, sec);
-        return (ret);
+        ft::pair<typename tree::node_pointer, bool> res = _avl.insert_value(x);
+        return (ft::make_pair(iterator(res.first, &_avl), res.second));
     }
 
 	iterator insert(iterator position, const value_type& x)
 	{
-		(void)position;
-		_avl.insert(x);
-		return (iterator(_avl.find(x.first), &_avl));
+		return (iterator(_avl.insert_hint(position.base(), x).first, &_avl));
 	}
 
+#if __cplusplus >= 201103L
+	/******************	C++11	********************
+	 * insert			an rvalue is moved into the node
+	 * emplace			builds the value in its node first, then looks its key up
+	 * emplace_hint		same, trying next to the hint first
+	******************************************************/
+	ft::pair<iterator,bool> insert(value_type&& x)
+	{
+        ft::pair<typename tree::node_pointer, bool> res = _avl.insert_value(std::move(x));
+        return (ft::make_pair(iterator(res.first, &_avl), res.second));
+    }
+
+	iterator insert(iterator position, value_type&& x)
+	{
+		return (iterator(_avl.insert_hint(position.base(), std::move(x)).first, &_avl));
+	}
+
+	template <class... Args>
+	ft::pair<iterator,bool> emplace(Args&&... args)
+	{
+        ft::pair<typename tree::node_pointer, bool> res = _avl.emplace_hint(0, std::forward<Args>(args)...);
+        return (ft::make_pair(iterator(res.first, &_avl), res.second));
+	}
+
+	template <class... Args>
+	iterator emplace_hint(iterator position, Args&&... args)
+	{
+		return (iterator(_avl.emplace_hint(position.base(), std::forward<Args>(args)...).first, &_avl));
+	}
+#endif
+
+	// sorted input is bulk built into an empty map, otherwise appended through an end() hint
 	template <class InputIterator>
 	void insert (InputIterator first, InputIterator last)
 	{
-		for (; first != last; first++)
-			_avl.insert(*first);
+		_avl.insert_range(first, last);
 		return ;
 	}
 
+    /******************	try_emplace / insert_or_assign	********************
+	 * try_emplace			inserts (k, obj) only if k is absent, never touches an existing value
+	 * insert_or_assign		inserts (k, obj) or assigns obj to the existing mapped value
+	 * both find the slot in a single descent
+	******************************************************/
+
+#if __cplusplus >= 201103L
+	// C++11: the mapped value is built from args, in place, only if k is absent
+	template <class... Args>
+	ft::pair<iterator,bool> try_emplace(const key_type& k, Args&&... args)
+	{
+		ft::pair<typename tree::node_pointer, bool> res = _avl.try_emplace(k, std::forward<Args>(args)...);
+		return (ft::make_pair(iterator(res.first, &_avl), res.second));
+	}
+
+	template <class... Args>
+	ft::pair<iterator,bool> try_emplace(key_type&& k, Args&&... args)
+	{
+		ft::pair<typename tree::node_pointer, bool> res = _avl.try_emplace(std::move(k), std::forward<Args>(args)...);
+		return (ft::make_pair(iterator(res.first, &_avl), res.second));
+	}
+
+	template <class M>
+	ft::pair<iterator,bool> insert_or_assign(const key_type& k, M&& obj)
+	{
+		ft::pair<typename tree::node_pointer, bool> res = _avl.try_emplace(k, std::forward<M>(obj));
+		if (!res.second)
+			res.first->_data.second = std::forward<M>(obj);
+		return (ft::make_pair(iterator(res.first, &_avl), res.second));
+	}
+
+	template <class M>
+	ft::pair<iterator,bool> insert_or_assign(key_type&& k, M&& obj)
+	{
+		ft::pair<typename tree::node_pointer, bool> res = _avl.try_emplace(std::move(k), std::forward<M>(obj));
+		if (!res.second)
+			res.first->_data.second = std::forward<M>(obj);
+		return (ft::make_pair(iterator(res.first, &_avl), res.second));
+	}
+#else
+	ft::pair<iterator,bool> try_emplace(const key_type& k)
+	{
+		ft::pair<typename tree::node_pointer, bool> res = _avl.find_or_insert(k);
+		return (ft::make_pair(iterator(res.first, &_avl), res.second));
+	}
+
+	ft::pair<iterator,bool> try_emplace(const key_type& k, const mapped_type& obj)
+	{
+		ft::pair<typename tree::node_pointer, bool> res = _avl.insert_unique(k, &obj);
+		return (ft::make_pair(iterator(res.first, &_avl), res.second));
+	}
+
+	ft::pair<iterator,bool> insert_or_assign(const key_type& k, const mapped_type& obj)
+	{
+		ft::pair<typename tree::node_pointer, bool> res = _avl.insert_unique(k, &obj);
+		if (!res.second)
+			res.first->_data.second = obj;
+		return (ft::make_pair(iterator(res.first, &_avl), res.second));
+	}
+#endif
+
    	void erase(iterator position)
 	{
-		key_type k = position->first;
-		_avl.remove(k);
+		_avl.erase_node(position.base());
 		return ;
 	}
 
@@ -186,27 +296,16 @@ public:
 
 	void erase(iterator first, iterator last)
 	{
-		std::vector<key_type> keys;
-		while (first != last)
-		{
-			keys.push_back(first->first);
-			first++;
-		}
-		for (size_t i = 0; i < keys.size(); i++)
-				_avl.remove(keys[i]);
-		for (size_t i = 0; i < keys.size(); i++)
-				erase(keys[i]);
-		keys.clear();
+		_avl.erase_range(first.base(), last.base());
 		return ;
 	}
 
+	// constant time, no allocation: the trees trade their nodes
 	void swap (map& x)
 	{
-		tree temp;
-
-		temp = x._avl;
-		x._avl = _avl;
-		_avl = temp;
+		_avl.swap(x._avl);
+		std::swap(_alloc, x._alloc);
+		std::swap(_comp, x._comp);
 		return ;
 	}
 
@@ -243,12 +342,12 @@ public:
 	
 	iterator find(const key_type& x)
     {
-        return (iterator(_avl.find(x), &_avl));
+        return (_avl.to_iterator(_avl.find(x)));
     }
 
     const_iterator find(const key_type& x) const
     {
-        return (iterator(_avl.find(x), &_avl));
+        return (_avl.to_iterator(_avl.find(x)));
     }
 
     size_type count(const key_type& x) const
@@ -285,6 +384,34 @@ public:
         ft::pair<const_iterator,const_iterator> ret =  ft::make_pair(lower_bound(x), upper_bound(x));
         return (ret);
     }       
+
+   	/******************	ORDER STATISTICS	********************
+	 * nth				iterator to the k-th element in key order (from 0), end() past the last one
+	 * rank				number of elements whose key goes before k
+	 * count_range		number of elements with a key in [lo, hi]
+	 * all O(log n), through the subtree sizes kept in the nodes
+	******************************************************/
+	iterator nth(size_type k)
+	{
+		return (_avl.to_iterator(_avl.select(k)));
+	}
+
+	const_iterator nth(size_type k) const
+	{
+		return (_avl.to_iterator(_avl.select(k)));
+	}
+
+	size_type rank(const key_type& k) const
+	{
+		return (_avl.rank(k));
+	}
+
+	size_type count_range(const key_type& lo, const key_type& hi) const
+	{
+		if (_comp(hi, lo))
+			return (0);
+		return (_avl.rank(hi, true) - _avl.rank(lo));
+	}
 };
 
 	template <class Key, class T, class Compare, class Allocator>
@@ -330,6 +457,303 @@ public:
     {
         x.swap(y);
     }
+
+/*****************************************	multimap	*****************************************
+* ft::map's tree with equal keys kept (ft::AVL with Multi, see avl.hpp): same nodes, pool,
+  hinted and bulk insertion, range erase and order statistics.
+* every insert adds an element, after those with an equal key (right before a fitting hint).
+* no operator[], try_emplace or insert_or_assign: a key does not name a single element.
+*************************************************************************************************/
+template <class Key, class T, class Compare = std::less<Key>, class Allocator = std::allocator<pair<const Key, T> > >
+class multimap
+{
+public:
+    typedef Key                                      key_type;
+    typedef T                                        mapped_type;
+    typedef ft::pair<const key_type, mapped_type>    value_type;
+    typedef Compare                                  key_compare;
+    typedef Allocator                                allocator_type;
+    typedef typename allocator_type::reference       reference;
+    typedef typename allocator_type::const_reference const_reference;
+    typedef typename allocator_type::pointer         pointer;
+    typedef typename allocator_type::const_pointer   const_pointer;
+    typedef std::ptrdiff_t                           difference_type;
+    typedef size_t                                   size_type;
+    typedef ft::AVL<key_type, value_type, ft::select_first<value_type>, Compare, Allocator, true>  tree;
+    typedef typename tree::iterator             	 iterator;
+    typedef typename tree::const_iterator       	 const_iterator;
+    typedef typename tree::reverse_iterator       	 reverse_iterator;
+    typedef typename tree::const_reverse_iterator	 const_reverse_iterator;
+
+    class value_compare: public std::binary_function<value_type, value_type, bool>
+    {
+        friend class multimap;
+        protected:
+            Compare comp;
+            value_compare(Compare c) : comp(c) {};
+        public:
+            typedef bool result_type;
+            typedef value_type first_argument_type;
+            typedef value_type second_argument_type;
+            bool operator() (const value_type& x, const value_type& y) const
+            {
+            	return comp(x.first, y.first);
+            }
+    };
+
+	private :
+            tree            _avl;
+            allocator_type	_alloc;
+            key_compare     _comp;
+
+	public :
+	/*****************	CONSTRUCTORS	******************/
+	explicit multimap(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _avl(comp, alloc), _alloc(alloc), _comp(comp)
+	{}
+
+	// non-descending input is built in linear time, see AVL::insert_range
+	template <class InputIterator>
+	multimap(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _avl(comp, alloc), _alloc(alloc), _comp(comp)
+	{
+		this->insert(first, last);
+	}
+
+	multimap(const multimap& x): _avl(x._avl), _alloc(x._alloc), _comp(x._comp) {}
+
+	multimap& operator=(const multimap& x)
+	{
+		if (this != &x)
+		{
+			_avl	= x._avl;
+			_alloc	= x._alloc;
+			_comp	= x._comp;
+		}
+		return (*this);
+	}
+
+#if __cplusplus >= 201103L
+	multimap(multimap&& x) noexcept : _avl(std::move(x._avl)), _alloc(x._alloc), _comp(x._comp) {}
+
+	multimap& operator=(multimap&& x) noexcept
+	{
+		if (this != &x)
+		{
+			_avl	= std::move(x._avl);
+			_alloc	= x._alloc;
+			_comp	= x._comp;
+		}
+		return (*this);
+	}
+#endif
+
+	~multimap() {
+		_avl.clear();
+	}
+
+	/*****************	ITERATOR	*********************/
+    iterator begin()				{	return (_avl.begin());	}
+    const_iterator begin() const	{	return (_avl.begin());	}
+
+	iterator end()					{	return (_avl.end());	}
+    const_iterator end()   const 	{	return(_avl.end());		}
+
+    reverse_iterator rbegin() 				{	return(_avl.rbegin());		}
+    const_reverse_iterator rbegin() const	{	return (_avl.rbegin());		}
+
+	reverse_iterator rend() 				{	return (_avl.rend());		}
+    const_reverse_iterator rend() const		{	return (_avl.rend());		}
+
+    /******************	CAPACITY	********************/
+    bool empty() const			{	return (_avl.empty());		}
+    size_type size() const		{	return (_avl.size());		}
+    size_type max_size() const	{	return (_avl.max_size());	}
+
+    /******************	MODIFIER	********************
+	 * insert			always inserts, returns the new element
+	 * erase			erase(k) removes every element with key k
+	 * swap
+	 * clear
+	******************************************************/
+	iterator insert(const value_type& x)
+	{
+        return (iterator(_avl.insert_value(x).first, &_avl));
+    }
+
+	iterator insert(iterator position, const value_type& x)
+	{
+		return (iterator(_avl.insert_hint(position.base(), x).first, &_avl));
+	}
+
+#if __cplusplus >= 201103L
+	iterator insert(value_type&& x)
+	{
+        return (iterator(_avl.insert_value(std::move(x)).first, &_avl));
+    }
+
+	iterator insert(iterator position, value_type&& x)
+	{
+		return (iterator(_avl.insert_hint(position.base(), std::move(x)).first, &_avl));
+	}
+
+	template <class... Args>
+	iterator emplace(Args&&... args)
+	{
+        return (iterator(_avl.emplace_hint(0, std::forward<Args>(args)...).first, &_avl));
+	}
+
+	template <class... Args>
+	iterator emplace_hint(iterator position, Args&&... args)
+	{
+		return (iterator(_avl.emplace_hint(position.base(), std::forward<Args>(args)...).first, &_avl));
+	}
+#endif
+
+	template <class InputIterator>
+	void insert (InputIterator first, InputIterator last)
+	{
+		_avl.insert_range(first, last);
+	}
+
+   	void erase(iterator position)
+	{
+		_avl.erase_node(position.base());
+	}
+
+	size_type erase(const key_type& k)
+	{
+		return (_avl.remove(k));
+	}
+
+	void erase(iterator first, iterator last)
+	{
+		_avl.erase_range(first.base(), last.base());
+	}
+
+	void swap (multimap& x)
+	{
+		_avl.swap(x._avl);
+		std::swap(_alloc, x._alloc);
+		std::swap(_comp, x._comp);
+	}
+
+    void clear()
+	{
+		_avl.clear();
+	}
+
+	/******************	OBSERVERS	********************/
+    key_compare key_comp() const		{	return (_comp);					}
+    value_compare value_comp() const	{	return (value_compare(_comp));	}
+
+    allocator_type get_allocator() const
+	{
+		return (_avl.get_allocator());
+	}
+
+   	/******************	MAP OPERATIONS	********************
+	 * find			the first element with key x
+	 * count		walks the elements with key x
+	******************************************************/
+	iterator find(const key_type& x)
+    {
+        return (_avl.to_iterator(_avl.find(x)));
+    }
+
+    const_iterator find(const key_type& x) const
+    {
+        return (_avl.to_iterator(_avl.find(x)));
+    }
+
+    size_type count(const key_type& x) const
+    {
+        return (_avl.count(x));
+    }
+
+    iterator lower_bound(const key_type& x)					{	return (_avl.bound(x, 2));	}
+    const_iterator lower_bound(const key_type& x) const		{	return (_avl.bound(x, 2));	}
+
+    iterator upper_bound(const key_type& x)					{	return (_avl.bound(x, 1));	}
+    const_iterator upper_bound(const key_type& x) const		{	return (_avl.bound(x, 1));	}
+
+    ft::pair<iterator,iterator> equal_range(const key_type& x)
+    {
+        return (ft::make_pair(lower_bound(x), upper_bound(x)));
+    }
+
+    ft::pair<const_iterator,const_iterator> equal_range(const key_type& x) const
+    {
+        return (ft::make_pair(lower_bound(x), upper_bound(x)));
+    }
+
+   	/******************	ORDER STATISTICS	********************
+	 * see ft::map
+	******************************************************/
+	iterator nth(size_type k)
+	{
+		return (_avl.to_iterator(_avl.select(k)));
+	}
+
+	const_iterator nth(size_type k) const
+	{
+		return (_avl.to_iterator(_avl.select(k)));
+	}
+
+	size_type rank(const key_type& k) const
+	{
+		return (_avl.rank(k));
+	}
+
+	size_type count_range(const key_type& lo, const key_type& hi) const
+	{
+		if (_comp(hi, lo))
+			return (0);
+		return (_avl.rank(hi, true) - _avl.rank(lo));
+	}
+};
+
+	template <class Key, class T, class Compare, class Allocator>
+    bool operator== ( const multimap<Key,T,Compare,Allocator>& lhs, const multimap<Key,T,Compare,Allocator>& rhs )
+    {
+        if (lhs.size() != rhs.size())
+            return (false);
+        return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+    }
+
+    template <class Key, class T, class Compare, class Allocator>
+    bool operator!= ( const multimap<Key,T,Compare,Allocator>& lhs, const multimap<Key,T,Compare,Allocator>& rhs )
+    {
+        return (!(lhs == rhs));
+    }
+
+    template <class Key, class T, class Compare, class Allocator>
+    bool operator<  ( const multimap<Key,T,Compare,Allocator>& lhs, const multimap<Key,T,Compare,Allocator>& rhs )
+    {
+        return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+    }
+
+    template <class Key, class T, class Compare, class Allocator>
+    bool operator> ( const multimap<Key,T,Compare,Allocator>& lhs, const multimap<Key,T,Compare,Allocator>& rhs )
+    {
+        return (rhs < lhs);
+    }
+
+    template <class Key, class T, class Compare, class Allocator>
+    bool operator>= ( const multimap<Key,T,Compare,Allocator>& lhs, const multimap<Key,T,Compare,Allocator>& rhs )
+    {
+        return (!(lhs < rhs));
+    }
+
+    template <class Key, class T, class Compare, class Allocator>
+    bool operator<= ( const multimap<Key,T,Compare,Allocator>& lhs, const multimap<Key,T,Compare,Allocator>& rhs )
+    {
+        return (!(rhs < lhs));
+    }
+
+    template <class Key, class T, class Compare, class Allocator>
+    void swap (multimap<Key,T,Compare,Allocator>& x, multimap<Key,T,Compare,Allocator>& y)
+    {
+        x.swap(y);
+    }
 };
 
 #endif
\ No newline at end of file
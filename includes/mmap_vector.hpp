@@ -0,0 +1,363 @@
+#ifndef MMAP_VECTOR_HPP
+#define MMAP_VECTOR_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <cerrno>
+#include <string>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../utlis/vec_iterator.hpp"
+#include "../utlis/reverse_iterator.hpp"
+#include "../utlis/equal.hpp"
+#include "../utlis/type_traits.hpp"
+#include "../utlis/growth_policy.hpp"
+
+namespace ft
+{
+	/*****************************************	mmap_vector	*****************************************
+	* An array of trivially copyable T kept in a file, used in place through mmap: opening is
+	  O(1) whatever the size, pages are read on first touch and shared through the page cache.
+	* The file is the raw elements, nothing else; its length gives size().
+	* read_only		PROT_READ, MAP_SHARED. writing through an element faults
+	* copy_on_write	MAP_PRIVATE: elements may be written, the file never changes; the size is fixed
+	* read_write	MAP_SHARED: writes go to the file and the vector can grow. growth extends the file
+	 				with ftruncate and the mapping with mremap (munmap + mmap without it), in steps
+					chosen by Growth; close() cuts the file back to size()
+	* Errors from the system throw std::runtime_error, growing a fixed size mapping std::logic_error.
+	*****************************************************************************************************/
+	template <class T, class Growth = ft::growth_paged<> >
+	class mmap_vector
+	{
+		// T is copied with plain bytes to and from the file
+		typedef char	requires_trivially_copyable[ft::is_trivially_copyable<T>::value ? 1 : -1];
+
+	public:
+		typedef T										value_type;
+		typedef T&										reference;
+		typedef const T&								const_reference;
+		typedef T*										pointer;
+		typedef const T*								const_pointer;
+		typedef std::size_t								size_type;
+		typedef std::ptrdiff_t							difference_type;
+		typedef ft::vec_iterator<T>						iterator;
+		typedef ft::vec_iterator<const T>				const_iterator;
+		typedef ft::reverse_iterator<iterator>			reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+		enum mode
+		{
+			read_only,
+			copy_on_write,
+			read_write
+		};
+
+	private:
+		value_type*	_arr;
+		size_type	_size;
+		size_type	_capacity;	// elements mapped (and, for read_write, in the file)
+		int			_fd;		// only kept open for read_write
+		mode		_mode;
+
+		mmap_vector(const mmap_vector&);
+		mmap_vector& operator=(const mmap_vector&);
+
+	public:
+		mmap_vector() : _arr(0), _size(0), _capacity(0), _fd(-1), _mode(read_only) {}
+
+		// read_write creates the file if needed
+		explicit mmap_vector(const char* path, mode m = read_only) : _arr(0), _size(0), _capacity(0), _fd(-1), _mode(read_only)
+		{
+			open(path, m);
+		}
+
+#if __cplusplus >= 201103L
+		mmap_vector(mmap_vector&& x) noexcept : _arr(0), _size(0), _capacity(0), _fd(-1), _mode(read_only)
+		{
+			swap(x);
+		}
+
+		// like the destructor, drops a failure to trim the file being closed: call close() first to see it
+		mmap_vector& operator=(mmap_vector&& x) noexcept
+		{
+			if (this != &x)
+			{
+				try
+				{
+					close();
+				}
+				catch (...)
+				{
+				}
+				swap(x);
+			}
+			return (*this);
+		}
+#endif
+
+		~mmap_vector()
+		{
+			try
+			{
+				close();
+			}
+			catch (...)
+			{
+			}
+		}
+
+		/*****************	FILE	******************
+		* open		maps path, closing what was open before
+		* close		unmaps; read_write trims the file to size()
+		* flush		read_write: writes dirty pages back now (msync)
+		**********************************************/
+		void open(const char* path, mode m = read_only)
+		{
+			close();
+
+			int fd = ::open(path, (m == read_write) ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+			struct stat st;
+
+			if (fd < 0)
+				fail("open", path);
+			if (::fstat(fd, &st) != 0)
+			{
+				int err = errno;
+				::close(fd);
+				errno = err;
+				fail("fstat", path);
+			}
+			_mode = m;
+			_fd = fd;
+			_size = static_cast<size_type>(st.st_size) / sizeof(value_type);
+			try
+			{
+				map(_size);
+			}
+			catch (...)
+			{
+				::close(_fd);
+				_fd = -1;
+				_size = 0;
+				throw;
+			}
+			if (m != read_write)
+			{
+				::close(_fd);
+				_fd = -1;
+			}
+		}
+
+		void close()
+		{
+			if (_arr != 0)
+				::munmap(static_cast<void*>(_arr), _capacity * sizeof(value_type));
+			_arr = 0;
+			_capacity = 0;
+			if (_fd >= 0)
+			{
+				int fd = _fd;
+				int res = ::ftruncate(fd, static_cast<off_t>(_size * sizeof(value_type)));
+
+				_fd = -1;
+				_size = 0;
+				::close(fd);
+				if (res != 0)
+					fail("ftruncate", 0);
+			}
+			_size = 0;
+		}
+
+		void flush()
+		{
+			if (_arr != 0 && _mode == read_write && ::msync(static_cast<void*>(_arr), _capacity * sizeof(value_type), MS_SYNC) != 0)
+				fail("msync", 0);
+		}
+
+		bool is_open() const			{	return (_arr != 0 || _fd >= 0);	}
+		mode get_mode() const			{	return (_mode);					}
+
+		/*****************	ITERATORS	******************/
+		iterator begin()				{	return iterator(_arr);				}
+		const_iterator begin() const	{	return const_iterator(_arr);		}
+
+		iterator end()					{	return iterator(_arr + _size);		}
+		const_iterator end() const		{	return const_iterator(_arr + _size);}
+
+		reverse_iterator rbegin()				{	return reverse_iterator(end());			}
+		const_reverse_iterator rbegin() const	{	return const_reverse_iterator(end());	}
+
+		reverse_iterator rend()					{	return reverse_iterator(begin());		}
+		const_reverse_iterator rend() const		{	return const_reverse_iterator(begin());	}
+
+		/*****************	CAPACITY	******************/
+		size_type size() const		{	return (_size);									}
+		size_type capacity() const	{	return (_capacity);								}
+		size_type max_size() const	{	return (static_cast<size_type>(-1) / sizeof(value_type));	}
+		bool empty() const			{	return (_size == 0);							}
+
+		// read_write only
+		void reserve(size_type n)
+		{
+			if (n <= _capacity)
+				return ;
+			if (_mode != read_write || _fd < 0)
+				throw std::logic_error("ft::mmap_vector: mapping can't grow");
+			if (n > max_size())
+				throw std::length_error("ft::mmap_vector::reserve");
+			if (::ftruncate(_fd, static_cast<off_t>(n * sizeof(value_type))) != 0)
+				fail("ftruncate", 0);
+			map(n);
+		}
+
+		void resize(size_type n, value_type val = value_type())
+		{
+			if (n > _capacity)
+				reserve(next_capacity(n));
+			for (size_type i = _size; i < n; i++)
+				_arr[i] = val;
+			_size = n;
+		}
+
+		/*****************	ELEMENT ACCESS	******************/
+		reference operator[](size_type n)				{	return (_arr[n]);	}
+		const_reference operator[](size_type n) const	{	return (_arr[n]);	}
+
+		reference at(size_type n)
+		{
+			if (_size <= n)
+				throw std::out_of_range("mmap_vector");
+			return (_arr[n]);
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (_size <= n)
+				throw std::out_of_range("mmap_vector");
+			return (_arr[n]);
+		}
+
+		reference front()				{	return (_arr[0]);			}
+		const_reference front() const	{	return (_arr[0]);			}
+		reference back()				{	return (_arr[_size - 1]);	}
+		const_reference back() const	{	return (_arr[_size - 1]);	}
+
+		T* data()						{	return (_arr);	}
+		const T* data() const			{	return (_arr);	}
+
+		/*****************	MODIFIERS	******************
+		* growing past capacity() needs read_write. pop_back and
+		  clear only forget elements, the file keeps them until close
+		**************************************************/
+		void push_back(const value_type& val)
+		{
+			if (_size == _capacity)
+			{
+				value_type copy(val);
+
+				reserve(next_capacity(_size + 1));
+				_arr[_size++] = copy;
+				return ;
+			}
+			_arr[_size++] = val;
+		}
+
+		void pop_back()		{	--_size;	}
+		void clear()		{	_size = 0;	}
+
+		void swap(mmap_vector& x)
+		{
+			std::swap(_arr, x._arr);
+			std::swap(_size, x._size);
+			std::swap(_capacity, x._capacity);
+			std::swap(_fd, x._fd);
+			std::swap(_mode, x._mode);
+		}
+
+	private:
+		size_type next_capacity(size_type required) const
+		{
+			size_type cap = Growth::grow(_capacity, required, sizeof(value_type));
+
+			if (cap > max_size() || cap < required)
+				cap = std::max(required, std::min(cap, max_size()));
+			return (cap);
+		}
+
+		// maps n elements of _fd, moving the current mapping if there is one
+		void map(size_type n)
+		{
+			size_type	bytes	= n * sizeof(value_type);
+			void*		p;
+
+			if (n == 0)
+				return ;
+			if (_arr != 0)
+			{
+#ifdef MREMAP_MAYMOVE
+				p = ::mremap(static_cast<void*>(_arr), _capacity * sizeof(value_type), bytes, MREMAP_MAYMOVE);
+#else
+				::munmap(static_cast<void*>(_arr), _capacity * sizeof(value_type));
+				_arr = 0;
+				_capacity = 0;
+				p = ::mmap(0, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+#endif
+			}
+			else
+				p = ::mmap(0, bytes, (_mode == read_only) ? PROT_READ : (PROT_READ | PROT_WRITE),
+							(_mode == copy_on_write) ? MAP_PRIVATE : MAP_SHARED, _fd, 0);
+			if (p == MAP_FAILED)
+				fail("mmap", 0);
+			_arr = static_cast<value_type*>(p);
+			_capacity = n;
+		}
+
+		static void fail(const char* what, const char* path)
+		{
+			std::string msg = std::string("ft::mmap_vector: ") + what;
+
+			if (path != 0)
+				msg = msg + " " + path;
+			throw std::runtime_error(msg + ": " + std::strerror(errno));
+		}
+	};
+
+	/**************		NON MEMBER FUNC.	***************/
+	template <class T, class Growth>
+	void swap(mmap_vector<T, Growth>& x, mmap_vector<T, Growth>& y)
+	{
+		x.swap(y);
+	}
+
+	template <class T, class Growth>
+	bool operator==(const mmap_vector<T, Growth>& l, const mmap_vector<T, Growth>& r)
+	{
+		if (l.size() != r.size())
+			return false;
+		return ft::equal(l.begin(), l.end(), r.begin());
+	}
+
+	template <class T, class Growth>
+	bool operator!=(const mmap_vector<T, Growth>& l, const mmap_vector<T, Growth>& r)	{	return !(l == r);	}
+
+	template <class T, class Growth>
+	bool operator<(const mmap_vector<T, Growth>& l, const mmap_vector<T, Growth>& r)
+	{
+		return ft::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end());
+	}
+
+	template <class T, class Growth>
+	bool operator>(const mmap_vector<T, Growth>& l, const mmap_vector<T, Growth>& r)	{	return (r < l);		}
+
+	template <class T, class Growth>
+	bool operator<=(const mmap_vector<T, Growth>& l, const mmap_vector<T, Growth>& r)	{	return !(l > r);	}
+
+	template <class T, class Growth>
+	bool operator>=(const mmap_vector<T, Growth>& l, const mmap_vector<T, Growth>& r)	{	return !(l < r);	}
+};
+
+#endif
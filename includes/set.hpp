@@ -0,0 +1,562 @@
+#ifndef SET_HPP
+#define SET_HPP
+
+#include <functional>
+#include <memory>
+#include <algorithm>
+#include <utility>
+#include "../utlis/pair.hpp"
+#include "../utlis/avl.hpp"
+#include "../utlis/equal.hpp"
+#include "../utlis/type_traits.hpp"
+
+
+namespace ft
+{
+
+/*****************************************	set / multiset	*****************************************
+* The same tree as ft::map (ft::AVL, see avl.hpp), keyed by the value itself: same nodes, pool,
+  hinted and bulk insertion, range erase and order statistics.
+* Elements are keys and must not change in place, so iterator and const_iterator are one type.
+* multiset keeps equal keys, each new one after those already there.
+*****************************************************************************************************/
+template <class Key, class Compare = std::less<Key>, class Allocator = std::allocator<Key> >
+class set
+{
+public:
+    typedef Key                                      key_type;
+    typedef Key                                      value_type;
+    typedef Compare                                  key_compare;
+    typedef Compare                                  value_compare;
+    typedef Allocator                                allocator_type;
+    typedef typename allocator_type::reference       reference;
+    typedef typename allocator_type::const_reference const_reference;
+    typedef typename allocator_type::pointer         pointer;
+    typedef typename allocator_type::const_pointer   const_pointer;
+    typedef std::ptrdiff_t                           difference_type;
+    typedef size_t                                   size_type;
+    typedef ft::AVL<key_type, value_type, ft::identity<value_type>, Compare, Allocator>  tree;
+    typedef typename tree::const_iterator       	 iterator;
+    typedef typename tree::const_iterator       	 const_iterator;
+    typedef typename tree::const_reverse_iterator	 reverse_iterator;
+    typedef typename tree::const_reverse_iterator	 const_reverse_iterator;
+
+	private :
+            tree            _avl;
+            allocator_type	_alloc;
+            key_compare     _comp;
+
+	public :
+	/*****************	CONSTRUCTORS	******************
+	 * empty
+	 * range
+	 * copy
+	 * destructor
+	******************************************************/
+	explicit set(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _avl(comp, alloc), _alloc(alloc), _comp(comp)
+	{}
+
+	// sorted input is built in linear time, see AVL::insert_range
+	template <class InputIterator>
+	set(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _avl(comp, alloc), _alloc(alloc), _comp(comp)
+	{
+		this->insert(first, last);
+	}
+
+	set(const set& x): _avl(x._avl), _alloc(x._alloc), _comp(x._comp) {}
+
+	set& operator=(const set& x)
+	{
+		if (this != &x)
+		{
+			_avl	= x._avl;
+			_alloc	= x._alloc;
+			_comp	= x._comp;
+		}
+		return (*this);
+	}
+
+#if __cplusplus >= 201103L
+	set(set&& x) noexcept : _avl(std::move(x._avl)), _alloc(x._alloc), _comp(x._comp) {}
+
+	set& operator=(set&& x) noexcept
+	{
+		if (this != &x)
+		{
+			_avl	= std::move(x._avl);
+			_alloc	= x._alloc;
+			_comp	= x._comp;
+		}
+		return (*this);
+	}
+#endif
+
+	~set() {
+		_avl.clear();
+	}
+
+	/*****************	ITERATOR	*********************/
+    iterator begin() const					{	return (_avl.begin());	}
+    iterator end() const					{	return (_avl.end());	}
+    reverse_iterator rbegin() const			{	return (_avl.rbegin());	}
+    reverse_iterator rend() const			{	return (_avl.rend());	}
+
+    /******************	CAPACITY	********************/
+    bool empty() const			{	return (_avl.empty());		}
+    size_type size() const		{	return (_avl.size());		}
+    size_type max_size() const	{	return (_avl.max_size());	}
+
+    /******************	MODIFIER	********************
+	 * insert			the existing element is returned when the key is already there
+	 * erase
+	 * swap
+	 * clear
+	******************************************************/
+	ft::pair<iterator,bool> insert(const value_type& x)
+	{
+        ft::pair<typename tree::node_pointer, bool> res = _avl.insert_value(x);
+        return (ft::make_pair(iterator(res.first, &_avl), res.second));
+    }
+
+	iterator insert(iterator position, const value_type& x)
+	{
+		return (iterator(_avl.insert_hint(node(position), x).first, &_avl));
+	}
+
+#if __cplusplus >= 201103L
+	ft::pair<iterator,bool> insert(value_type&& x)
+	{
+        ft::pair<typename tree::node_pointer, bool> res = _avl.insert_value(std::move(x));
+        return (ft::make_pair(iterator(res.first, &_avl), res.second));
+    }
+
+	iterator insert(iterator position, value_type&& x)
+	{
+		return (iterator(_avl.insert_hint(node(position), std::move(x)).first, &_avl));
+	}
+
+	template <class... Args>
+	ft::pair<iterator,bool> emplace(Args&&... args)
+	{
+        ft::pair<typename tree::node_pointer, bool> res = _avl.emplace_hint(0, std::forward<Args>(args)...);
+        return (ft::make_pair(iterator(res.first, &_avl), res.second));
+	}
+
+	template <class... Args>
+	iterator emplace_hint(iterator position, Args&&... args)
+	{
+		return (iterator(_avl.emplace_hint(node(position), std::forward<Args>(args)...).first, &_avl));
+	}
+#endif
+
+	template <class InputIterator>
+	void insert (InputIterator first, InputIterator last)
+	{
+		_avl.insert_range(first, last);
+	}
+
+   	void erase(iterator position)
+	{
+		_avl.erase_node(node(position));
+	}
+
+	size_type erase(const key_type& k)
+	{
+		return (_avl.remove(k));
+	}
+
+	void erase(iterator first, iterator last)
+	{
+		_avl.erase_range(node(first), node(last));
+	}
+
+	void swap (set& x)
+	{
+		_avl.swap(x._avl);
+		std::swap(_alloc, x._alloc);
+		std::swap(_comp, x._comp);
+	}
+
+    void clear()
+	{
+		_avl.clear();
+	}
+
+	/******************	OBSERVERS	********************/
+    key_compare key_comp() const		{	return (_comp);	}
+    value_compare value_comp() const	{	return (_comp);	}
+
+    allocator_type get_allocator() const
+	{
+		return (_avl.get_allocator());
+	}
+
+   	/******************	SET OPERATIONS	********************
+	 * find
+	 * count
+	 * lower_bound
+	 * upper_bound
+	 * equal_range
+	******************************************************/
+    iterator find(const key_type& x) const
+    {
+        return (_avl.to_iterator(_avl.find(x)));
+    }
+
+    size_type count(const key_type& x) const
+    {
+        return (_avl.contains(x));
+    }
+
+    iterator lower_bound(const key_type& x) const
+    {
+        return (_avl.bound(x, 2));
+    }
+
+    iterator upper_bound(const key_type& x) const
+    {
+        return (_avl.bound(x, 1));
+    }
+
+    ft::pair<iterator,iterator> equal_range(const key_type& x) const
+    {
+        return (ft::make_pair(lower_bound(x), upper_bound(x)));
+    }
+
+   	/******************	ORDER STATISTICS	********************
+	 * see ft::map
+	******************************************************/
+	iterator nth(size_type k) const
+	{
+		return (_avl.to_iterator(_avl.select(k)));
+	}
+
+	size_type rank(const key_type& k) const
+	{
+		return (_avl.rank(k));
+	}
+
+	size_type count_range(const key_type& lo, const key_type& hi) const
+	{
+		if (_comp(hi, lo))
+			return (0);
+		return (_avl.rank(hi, true) - _avl.rank(lo));
+	}
+
+	private :
+	// the tree wants its own node back: set iterators are const ones
+	static typename tree::node_pointer node(iterator it)
+	{
+		return (const_cast<typename tree::node_pointer>(it.base()));
+	}
+};
+
+template <class Key, class Compare = std::less<Key>, class Allocator = std::allocator<Key> >
+class multiset
+{
+public:
+    typedef Key                                      key_type;
+    typedef Key                                      value_type;
+    typedef Compare                                  key_compare;
+    typedef Compare                                  value_compare;
+    typedef Allocator                                allocator_type;
+    typedef typename allocator_type::reference       reference;
+    typedef typename allocator_type::const_reference const_reference;
+    typedef typename allocator_type::pointer         pointer;
+    typedef typename allocator_type::const_pointer   const_pointer;
+    typedef std::ptrdiff_t                           difference_type;
+    typedef size_t                                   size_type;
+    typedef ft::AVL<key_type, value_type, ft::identity<value_type>, Compare, Allocator, true>  tree;
+    typedef typename tree::const_iterator       	 iterator;
+    typedef typename tree::const_iterator       	 const_iterator;
+    typedef typename tree::const_reverse_iterator	 reverse_iterator;
+    typedef typename tree::const_reverse_iterator	 const_reverse_iterator;
+
+	private :
+            tree            _avl;
+            allocator_type	_alloc;
+            key_compare     _comp;
+
+	public :
+	/*****************	CONSTRUCTORS	******************/
+	explicit multiset(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _avl(comp, alloc), _alloc(alloc), _comp(comp)
+	{}
+
+	// non-descending input is built in linear time, see AVL::insert_range
+	template <class InputIterator>
+	multiset(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()): _avl(comp, alloc), _alloc(alloc), _comp(comp)
+	{
+		this->insert(first, last);
+	}
+
+	multiset(const multiset& x): _avl(x._avl), _alloc(x._alloc), _comp(x._comp) {}
+
+	multiset& operator=(const multiset& x)
+	{
+		if (this != &x)
+		{
+			_avl	= x._avl;
+			_alloc	= x._alloc;
+			_comp	= x._comp;
+		}
+		return (*this);
+	}
+
+#if __cplusplus >= 201103L
+	multiset(multiset&& x) noexcept : _avl(std::move(x._avl)), _alloc(x._alloc), _comp(x._comp) {}
+
+	multiset& operator=(multiset&& x) noexcept
+	{
+		if (this != &x)
+		{
+			_avl	= std::move(x._avl);
+			_alloc	= x._alloc;
+			_comp	= x._comp;
+		}
+		return (*this);
+	}
+#endif
+
+	~multiset() {
+		_avl.clear();
+	}
+
+	/*****************	ITERATOR	*********************/
+    iterator begin() const					{	return (_avl.begin());	}
+    iterator end() const					{	return (_avl.end());	}
+    reverse_iterator rbegin() const			{	return (_avl.rbegin());	}
+    reverse_iterator rend() const			{	return (_avl.rend());	}
+
+    /******************	CAPACITY	********************/
+    bool empty() const			{	return (_avl.empty());		}
+    size_type size() const		{	return (_avl.size());		}
+    size_type max_size() const	{	return (_avl.max_size());	}
+
+    /******************	MODIFIER	********************
+	 * insert			always inserts, after the equal keys (right before a
+						fitting hint)
+	 * erase			erase(k) removes every element equal to k
+	 * swap
+	 * clear
+	******************************************************/
+	iterator insert(const value_type& x)
+	{
+        return (iterator(_avl.insert_value(x).first, &_avl));
+    }
+
+	iterator insert(iterator position, const value_type& x)
+	{
+		return (iterator(_avl.insert_hint(node(position), x).first, &_avl));
+	}
+
+#if __cplusplus >= 201103L
+	iterator insert(value_type&& x)
+	{
+        return (iterator(_avl.insert_value(std::move(x)).first, &_avl));
+    }
+
+	iterator insert(iterator position, value_type&& x)
+	{
+		return (iterator(_avl.insert_hint(node(position), std::move(x)).first, &_avl));
+	}
+
+	template <class... Args>
+	iterator emplace(Args&&... args)
+	{
+        return (iterator(_avl.emplace_hint(0, std::forward<Args>(args)...).first, &_avl));
+	}
+
+	template <class... Args>
+	iterator emplace_hint(iterator position, Args&&... args)
+	{
+		return (iterator(_avl.emplace_hint(node(position), std::forward<Args>(args)...).first, &_avl));
+	}
+#endif
+
+	template <class InputIterator>
+	void insert (InputIterator first, InputIterator last)
+	{
+		_avl.insert_range(first, last);
+	}
+
+   	void erase(iterator position)
+	{
+		_avl.erase_node(node(position));
+	}
+
+	size_type erase(const key_type& k)
+	{
+		return (_avl.remove(k));
+	}
+
+	void erase(iterator first, iterator last)
+	{
+		_avl.erase_range(node(first), node(last));
+	}
+
+	void swap (multiset& x)
+	{
+		_avl.swap(x._avl);
+		std::swap(_alloc, x._alloc);
+		std::swap(_comp, x._comp);
+	}
+
+    void clear()
+	{
+		_avl.clear();
+	}
+
+	/******************	OBSERVERS	********************/
+    key_compare key_comp() const		{	return (_comp);	}
+    value_compare value_comp() const	{	return (_comp);	}
+
+    allocator_type get_allocator() const
+	{
+		return (_avl.get_allocator());
+	}
+
+   	/******************	SET OPERATIONS	********************
+	 * find			the first element equal to x
+	 * count		walks the equal elements
+	******************************************************/
+    iterator find(const key_type& x) const
+    {
+        return (_avl.to_iterator(_avl.find(x)));
+    }
+
+    size_type count(const key_type& x) const
+    {
+        return (_avl.count(x));
+    }
+
+    iterator lower_bound(const key_type& x) const
+    {
+        return (_avl.bound(x, 2));
+    }
+
+    iterator upper_bound(const key_type& x) const
+    {
+        return (_avl.bound(x, 1));
+    }
+
+    ft::pair<iterator,iterator> equal_range(const key_type& x) const
+    {
+        return (ft::make_pair(lower_bound(x), upper_bound(x)));
+    }
+
+   	/******************	ORDER STATISTICS	********************/
+	iterator nth(size_type k) const
+	{
+		return (_avl.to_iterator(_avl.select(k)));
+	}
+
+	size_type rank(const key_type& k) const
+	{
+		return (_avl.rank(k));
+	}
+
+	size_type count_range(const key_type& lo, const key_type& hi) const
+	{
+		if (_comp(hi, lo))
+			return (0);
+		return (_avl.rank(hi, true) - _avl.rank(lo));
+	}
+
+	private :
+	static typename tree::node_pointer node(iterator it)
+	{
+		return (const_cast<typename tree::node_pointer>(it.base()));
+	}
+};
+
+	/******************	NON MEMBER FUNC.	********************/
+	template <class Key, class Compare, class Allocator>
+    bool operator== ( const set<Key,Compare,Allocator>& lhs, const set<Key,Compare,Allocator>& rhs )
+    {
+        if (lhs.size() != rhs.size())
+            return (false);
+        return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+    }
+
+    template <class Key, class Compare, class Allocator>
+    bool operator!= ( const set<Key,Compare,Allocator>& lhs, const set<Key,Compare,Allocator>& rhs )
+    {
+        return (!(lhs == rhs));
+    }
+
+    template <class Key, class Compare, class Allocator>
+    bool operator<  ( const set<Key,Compare,Allocator>& lhs, const set<Key,Compare,Allocator>& rhs )
+    {
+        return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+    }
+
+    template <class Key, class Compare, class Allocator>
+    bool operator> ( const set<Key,Compare,Allocator>& lhs, const set<Key,Compare,Allocator>& rhs )
+    {
+        return (rhs < lhs);
+    }
+
+    template <class Key, class Compare, class Allocator>
+    bool operator>= ( const set<Key,Compare,Allocator>& lhs, const set<Key,Compare,Allocator>& rhs )
+    {
+        return (!(lhs < rhs));
+    }
+
+    template <class Key, class Compare, class Allocator>
+    bool operator<= ( const set<Key,Compare,Allocator>& lhs, const set<Key,Compare,Allocator>& rhs )
+    {
+        return (!(rhs < lhs));
+    }
+
+    template <class Key, class Compare, class Allocator>
+    void swap (set<Key,Compare,Allocator>& x, set<Key,Compare,Allocator>& y)
+    {
+        x.swap(y);
+    }
+
+	template <class Key, class Compare, class Allocator>
+    bool operator== ( const multiset<Key,Compare,Allocator>& lhs, const multiset<Key,Compare,Allocator>& rhs )
+    {
+        if (lhs.size() != rhs.size())
+            return (false);
+        return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+    }
+
+    template <class Key, class Compare, class Allocator>
+    bool operator!= ( const multiset<Key,Compare,Allocator>& lhs, const multiset<Key,Compare,Allocator>& rhs )
+    {
+        return (!(lhs == rhs));
+    }
+
+    template <class Key, class Compare, class Allocator>
+    bool operator<  ( const multiset<Key,Compare,Allocator>& lhs, const multiset<Key,Compare,Allocator>& rhs )
+    {
+        return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+    }
+
+    template <class Key, class Compare, class Allocator>
+    bool operator> ( const multiset<Key,Compare,Allocator>& lhs, const multiset<Key,Compare,Allocator>& rhs )
+    {
+        return (rhs < lhs);
+    }
+
+    template <class Key, class Compare, class Allocator>
+    bool operator>= ( const multiset<Key,Compare,Allocator>& lhs, const multiset<Key,Compare,Allocator>& rhs )
+    {
+        return (!(lhs < rhs));
+    }
+
+    template <class Key, class Compare, class Allocator>
+    bool operator<= ( const multiset<Key,Compare,Allocator>& lhs, const multiset<Key,Compare,Allocator>& rhs )
+    {
+        return (!(rhs < lhs));
+    }
+
+    template <class Key, class Compare, class Allocator>
+    void swap (multiset<Key,Compare,Allocator>& x, multiset<Key,Compare,Allocator>& y)
+    {
+        x.swap(y);
+    }
+};
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include "vector.hpp"
+#include "../utlis/inline_allocator.hpp"
+
+namespace ft
+{
+	// N elements fit inline, past that Growth decides as usual
+	template <std::size_t N, class Growth = ft::growth_double>
+	struct growth_inline
+	{
+		static std::size_t grow(std::size_t capacity, std::size_t required, std::size_t elem_size)
+		{
+			if (required <= N)
+				return (N);
+			return (Growth::grow(capacity, required, elem_size));
+		}
+	};
+
+	/*****************************************	small_vector	*****************************************
+	* An ft::vector that keeps its first N elements inside the object and only goes to the heap past that.
+	* Everything but swap and the constructors is ft::vector's own code: the inline storage lives in
+	  the allocator (see inline_allocator.hpp), and the growth policy never asks for less than N.
+	* Unlike ft::vector, swapping copies the elements of a side that is still inline.
+	*****************************************************************************************************/
+	template <class T, std::size_t N, class Allocator = std::allocator<T> >
+	class small_vector : public ft::vector<T, ft::inline_allocator<T, N, Allocator>, ft::growth_inline<N> >
+	{
+		public:
+			typedef ft::vector<T, ft::inline_allocator<T, N, Allocator>, ft::growth_inline<N> >	vector_type;
+			typedef typename vector_type::value_type			value_type;
+			typedef typename vector_type::size_type				size_type;
+			typedef typename vector_type::allocator_type		allocator_type;
+			typedef typename vector_type::iterator				iterator;
+			typedef typename vector_type::const_iterator		const_iterator;
+
+			static const size_type	inline_capacity = N;
+
+			/*****************	CONSTRUCTORS	******************
+			 * all of them start on the inline buffer
+			******************************************************/
+			explicit small_vector(const Allocator& alloc = Allocator()) : vector_type(allocator_type(alloc))
+			{
+				this->reserve(N);
+			}
+
+			explicit small_vector(size_type n, const value_type& val = value_type(), const Allocator& alloc = Allocator()) : vector_type(allocator_type(alloc))
+			{
+				this->reserve(std::max(n, static_cast<size_type>(N)));
+				this->assign(n, val);
+			}
+
+			template <class InputIterator>
+			small_vector(InputIterator first, InputIterator last, const Allocator& alloc = Allocator(), typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = 0) : vector_type(allocator_type(alloc))
+			{
+				this->reserve(N);
+				this->assign(first, last);
+			}
+
+			small_vector(const small_vector& x) : vector_type(x.get_allocator())
+			{
+				this->reserve(std::max(x.size(), static_cast<size_type>(N)));
+				vector_type::operator=(x);
+			}
+
+			small_vector& operator=(const small_vector& x)
+			{
+				vector_type::operator=(x);
+				return (*this);
+			}
+
+#if __cplusplus >= 201103L
+			// C++11: a heap buffer is taken over, inline elements are relocated
+			small_vector(small_vector&& x) : vector_type(x.get_allocator())
+			{
+				this->reserve(N);
+				take(x);
+			}
+
+			small_vector& operator=(small_vector&& x)
+			{
+				if (this != &x)
+				{
+					this->clear();
+					take(x);
+				}
+				return (*this);
+			}
+#endif
+
+			// true while the elements are still in the object itself
+			bool is_inline() const	{	return (this->_alloc.is_inline(this->_arr));	}
+
+			// a heap buffer shrinks, or is left for the inline one once the elements fit there
+			void shrink_to_fit()
+			{
+				if (is_inline() || this->_size == this->_capacity)
+					return ;
+				if (this->_size > N)
+					return (vector_type::shrink_to_fit());
+
+				value_type*	old = this->_arr;
+
+				this->_arr = this->_alloc.allocate(N);
+				ft::uninitialized_relocate(this->_alloc, old, old + this->_size, this->_arr);
+				this->_alloc.deallocate(old, this->_capacity);
+				this->_capacity = N;
+			}
+
+			// heap buffers change hands, inline elements are relocated
+			void swap(small_vector& x)
+			{
+				if (this == &x)
+					return ;
+				if (!is_inline() && !x.is_inline())
+					return (vector_type::swap(x));
+
+				small_vector tmp(this->_alloc.get_heap_allocator());
+
+				tmp.take(*this);
+				this->take(x);
+				x.take(tmp);
+			}
+
+		private:
+			// this must be empty (it may keep its buffer); x is left empty and back on its inline buffer
+			void take(small_vector& x)
+			{
+				if (!x.is_inline())
+				{
+					this->_alloc.deallocate(this->_arr, this->_capacity);
+					this->_arr		= x._arr;
+					this->_capacity	= x._capacity;
+					this->_size		= x._size;
+					x._arr		= 0;
+					x._size		= 0;
+					x._capacity	= 0;
+					x.reserve(N);
+					return ;
+				}
+				this->reserve(x._size);
+				ft::uninitialized_relocate(this->_alloc, x._arr, x._arr + x._size, this->_arr);
+				this->_size = x._size;
+				x._size = 0;
+			}
+	};
+
+	// picked over ft::swap(vector&, vector&), which would swap the pointers only
+	template <class T, std::size_t N, class Alloc>
+	void swap(small_vector<T, N, Alloc>& x, small_vector<T, N, Alloc>& y)
+	{
+		x.swap(y);
+	}
+};
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef STACK_HPP
 #define STACK_HPP
 
+#include <utility>
 #include "vector.hpp" 
 
 namespace ft	//userdefined namespace
@@ -19,6 +20,9 @@ namespace ft	//userdefined namespace
 
 		public:
 			explicit stack (const container_type& c1 = container_type()) : c(c1) {};
+#if __cplusplus >= 201103L
+			explicit stack (container_type&& c1) : c(std::move(c1)) {};
+#endif
 
 			/********* MEMBER FUNCTIONS *********/
 			// Element access
@@ -31,6 +35,12 @@ namespace ft	//userdefined namespace
 
 			// Modifiers
 			void push(const value_type& x)	{	c.push_back(x);		}
+#if __cplusplus >= 201103L
+			void push(value_type&& x)		{	c.push_back(std::move(x));	}
+
+			template <class... Args>
+			void emplace(Args&&... args)	{	c.emplace_back(std::forward<Args>(args)...);	}
+#endif
 			void pop()						{	c.pop_back();		}
 
 			// Relational operators- Non member function
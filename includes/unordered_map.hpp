@@ -0,0 +1,283 @@
+#ifndef UNORDERED_MAP_HPP
+#define UNORDERED_MAP_HPP
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include "../utlis/pair.hpp"
+#include "../utlis/hash.hpp"
+#include "../utlis/hash_table.hpp"
+#include "../utlis/type_traits.hpp"
+
+namespace ft
+{
+
+/*****************************************	unordered_map	*****************************************
+* ft::map's interface without the order: a point lookup is a hash, one probe of 16 control bytes
+  and, in the common case, a single key comparison (see hash_table.hpp).
+* No bucket interface: the table has slots, not buckets. bucket_count() is the number of slots.
+* Iteration order is the slot order; any insertion may rehash and invalidate iterators.
+*************************************************************************************************/
+template <class Key, class T, class Hash = ft::hash<Key>, class Pred = std::equal_to<Key>, class Allocator = std::allocator<pair<const Key, T> > >
+class unordered_map
+{
+public:
+    typedef Key                                      key_type;
+    typedef T                                        mapped_type;
+    typedef ft::pair<const key_type, mapped_type>    value_type;
+    typedef Hash                                     hasher;
+    typedef Pred                                     key_equal;
+    typedef Allocator                                allocator_type;
+    typedef typename allocator_type::reference       reference;
+    typedef typename allocator_type::const_reference const_reference;
+    typedef typename allocator_type::pointer         pointer;
+    typedef typename allocator_type::const_pointer   const_pointer;
+    typedef std::ptrdiff_t                           difference_type;
+    typedef size_t                                   size_type;
+    typedef ft::hash_table<key_type, value_type, ft::select_first<value_type>, Hash, Pred, Allocator>  table;
+    typedef typename table::iterator                 iterator;
+    typedef typename table::const_iterator           const_iterator;
+
+	private :
+			table	_table;
+
+	public :
+	/*****************	CONSTRUCTORS	******************
+	 * empty		n: slots to start with
+	 * range
+	 * copy			same slots, nothing is hashed again
+	******************************************************/
+	explicit unordered_map(size_type n = 0, const hasher& hf = hasher(), const key_equal& eq = key_equal(), const allocator_type& alloc = allocator_type())
+		: _table(n, hf, eq, alloc)
+	{}
+
+	template <class InputIterator>
+	unordered_map(InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(), const key_equal& eq = key_equal(), const allocator_type& alloc = allocator_type())
+		: _table(n, hf, eq, alloc)
+	{
+		this->insert(first, last);
+	}
+
+	unordered_map(const unordered_map& x) : _table(x._table) {}
+
+	unordered_map& operator=(const unordered_map& x)
+	{
+		_table = x._table;
+		return (*this);
+	}
+
+#if __cplusplus >= 201103L
+	unordered_map(unordered_map&& x) noexcept : _table(std::move(x._table)) {}
+
+	unordered_map& operator=(unordered_map&& x) noexcept
+	{
+		_table = std::move(x._table);
+		return (*this);
+	}
+#endif
+
+	~unordered_map() {}
+
+	/*****************	ITERATOR	*********************/
+	iterator begin()				{	return (_table.begin());	}
+	const_iterator begin() const	{	return (_table.begin());	}
+	iterator end()					{	return (_table.end());		}
+	const_iterator end() const		{	return (_table.end());		}
+
+	/******************	CAPACITY	********************/
+	bool empty() const			{	return (_table.empty());	}
+	size_type size() const		{	return (_table.size());		}
+	size_type max_size() const	{	return (_table.max_size());	}
+
+	/******************	ELEMENT ACCESS	********************/
+	mapped_type& operator[](const key_type& k)
+	{
+		return (_table.to_iterator(_table.find_or_insert(k).first)->second);
+	}
+
+#if __cplusplus >= 201103L
+	mapped_type& operator[](key_type&& k)
+	{
+		return (_table.to_iterator(_table.try_emplace(std::move(k)).first)->second);
+	}
+#endif
+
+	/******************	MODIFIER	********************
+	 * insert			the hint is ignored: the hash says where an element goes
+	 * try_emplace		inserts (k, obj) only if k is absent
+	 * insert_or_assign	inserts (k, obj) or assigns obj to the existing mapped value
+	 * erase
+	 * swap
+	 * clear			destroys the elements, keeps the slots
+	******************************************************/
+	ft::pair<iterator,bool> insert(const value_type& x)
+	{
+		return (result(_table.insert_value(x)));
+	}
+
+	iterator insert(const_iterator, const value_type& x)
+	{
+		return (insert(x).first);
+	}
+
+	template <class InputIterator>
+	void insert(InputIterator first, InputIterator last)
+	{
+		for (; first != last; ++first)
+			_table.insert_value(*first);
+	}
+
+#if __cplusplus >= 201103L
+	ft::pair<iterator,bool> insert(value_type&& x)
+	{
+		return (result(_table.insert_value(std::move(x))));
+	}
+
+	template <class... Args>
+	ft::pair<iterator,bool> emplace(Args&&... args)
+	{
+		return (result(_table.emplace(std::forward<Args>(args)...)));
+	}
+
+	template <class... Args>
+	ft::pair<iterator,bool> try_emplace(const key_type& k, Args&&... args)
+	{
+		return (result(_table.try_emplace(k, std::forward<Args>(args)...)));
+	}
+
+	template <class... Args>
+	ft::pair<iterator,bool> try_emplace(key_type&& k, Args&&... args)
+	{
+		return (result(_table.try_emplace(std::move(k), std::forward<Args>(args)...)));
+	}
+
+	template <class M>
+	ft::pair<iterator,bool> insert_or_assign(const key_type& k, M&& obj)
+	{
+		ft::pair<iterator,bool> res = try_emplace(k, std::forward<M>(obj));
+		if (!res.second)
+			res.first->second = std::forward<M>(obj);
+		return (res);
+	}
+
+	template <class M>
+	ft::pair<iterator,bool> insert_or_assign(key_type&& k, M&& obj)
+	{
+		ft::pair<iterator,bool> res = try_emplace(std::move(k), std::forward<M>(obj));
+		if (!res.second)
+			res.first->second = std::forward<M>(obj);
+		return (res);
+	}
+#else
+	ft::pair<iterator,bool> try_emplace(const key_type& k)
+	{
+		return (result(_table.find_or_insert(k)));
+	}
+
+	ft::pair<iterator,bool> try_emplace(const key_type& k, const mapped_type& obj)
+	{
+		return (result(_table.insert_unique(k, &obj)));
+	}
+
+	ft::pair<iterator,bool> insert_or_assign(const key_type& k, const mapped_type& obj)
+	{
+		ft::pair<iterator,bool> res = result(_table.insert_unique(k, &obj));
+		if (!res.second)
+			res.first->second = obj;
+		return (res);
+	}
+#endif
+
+	void erase(const_iterator position)
+	{
+		_table.erase_slot(_table.index(position));
+	}
+
+	size_type erase(const key_type& k)
+	{
+		return (_table.remove(k));
+	}
+
+	// erasing never moves an element, so the range can be walked as it goes
+	void erase(const_iterator first, const_iterator last)
+	{
+		while (first != last)
+			erase(first++);
+	}
+
+	void swap(unordered_map& x)		{	_table.swap(x._table);	}
+	void clear()					{	_table.clear();			}
+
+	/******************	LOOKUP	********************/
+	iterator find(const key_type& k)				{	return (_table.to_iterator(_table.find(k)));	}
+	const_iterator find(const key_type& k) const	{	return (_table.to_iterator(_table.find(k)));	}
+
+	size_type count(const key_type& k) const		{	return (_table.contains(k));	}
+
+	ft::pair<iterator,iterator> equal_range(const key_type& k)
+	{
+		iterator it = find(k);
+		return (ft::make_pair(it, (it == end()) ? it : ++iterator(it)));
+	}
+
+	ft::pair<const_iterator,const_iterator> equal_range(const key_type& k) const
+	{
+		const_iterator it = find(k);
+		return (ft::make_pair(it, (it == end()) ? it : ++const_iterator(it)));
+	}
+
+	/******************	HASH POLICY	********************
+	 * rehash			at least n slots, and enough for size() elements
+	 * reserve			room for n elements without rehashing
+	 * max_load_factor	clamped to [1/16, 15/16], the default is 7/8
+	******************************************************/
+	size_type bucket_count() const			{	return (_table.capacity());			}
+	float load_factor() const				{	return (_table.load_factor());		}
+	float max_load_factor() const			{	return (_table.max_load_factor());	}
+	void max_load_factor(float ml)			{	_table.max_load_factor(ml);			}
+	void rehash(size_type n)				{	_table.rehash(n);					}
+	void reserve(size_type n)				{	_table.reserve(n);					}
+
+	/******************	OBSERVERS	********************/
+	hasher hash_function() const			{	return (_table.hash_function());	}
+	key_equal key_eq() const				{	return (_table.key_eq());			}
+	allocator_type get_allocator() const	{	return (_table.get_allocator());	}
+
+	private :
+	ft::pair<iterator,bool> result(const ft::pair<size_type, bool>& res)
+	{
+		return (ft::make_pair(_table.to_iterator(res.first), res.second));
+	}
+};
+
+	/******************	NON MEMBER FUNC.	********************
+	 * == looks every element of lhs up in rhs
+	******************************************************/
+	template <class Key, class T, class Hash, class Pred, class Allocator>
+	bool operator== (const unordered_map<Key,T,Hash,Pred,Allocator>& lhs, const unordered_map<Key,T,Hash,Pred,Allocator>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		for (typename unordered_map<Key,T,Hash,Pred,Allocator>::const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+		{
+			typename unordered_map<Key,T,Hash,Pred,Allocator>::const_iterator other = rhs.find(it->first);
+			if (other == rhs.end() || !(other->second == it->second))
+				return (false);
+		}
+		return (true);
+	}
+
+	template <class Key, class T, class Hash, class Pred, class Allocator>
+	bool operator!= (const unordered_map<Key,T,Hash,Pred,Allocator>& lhs, const unordered_map<Key,T,Hash,Pred,Allocator>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class T, class Hash, class Pred, class Allocator>
+	void swap (unordered_map<Key,T,Hash,Pred,Allocator>& x, unordered_map<Key,T,Hash,Pred,Allocator>& y)
+	{
+		x.swap(y);
+	}
+};
+
+#endif
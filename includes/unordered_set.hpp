@@ -0,0 +1,190 @@
+#ifndef UNORDERED_SET_HPP
+#define UNORDERED_SET_HPP
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include "../utlis/pair.hpp"
+#include "../utlis/hash.hpp"
+#include "../utlis/hash_table.hpp"
+#include "../utlis/type_traits.hpp"
+
+namespace ft
+{
+
+/*****************************************	unordered_set	*****************************************
+* ft::unordered_map's table keyed by the value itself (see hash_table.hpp).
+* Elements are keys and must not change in place, so iterator and const_iterator are one type.
+*************************************************************************************************/
+template <class Key, class Hash = ft::hash<Key>, class Pred = std::equal_to<Key>, class Allocator = std::allocator<Key> >
+class unordered_set
+{
+public:
+    typedef Key                                      key_type;
+    typedef Key                                      value_type;
+    typedef Hash                                     hasher;
+    typedef Pred                                     key_equal;
+    typedef Allocator                                allocator_type;
+    typedef typename allocator_type::reference       reference;
+    typedef typename allocator_type::const_reference const_reference;
+    typedef typename allocator_type::pointer         pointer;
+    typedef typename allocator_type::const_pointer   const_pointer;
+    typedef std::ptrdiff_t                           difference_type;
+    typedef size_t                                   size_type;
+    typedef ft::hash_table<key_type, value_type, ft::identity<value_type>, Hash, Pred, Allocator>  table;
+    typedef typename table::const_iterator           iterator;
+    typedef typename table::const_iterator           const_iterator;
+
+	private :
+			table	_table;
+
+	public :
+	/*****************	CONSTRUCTORS	******************/
+	explicit unordered_set(size_type n = 0, const hasher& hf = hasher(), const key_equal& eq = key_equal(), const allocator_type& alloc = allocator_type())
+		: _table(n, hf, eq, alloc)
+	{}
+
+	template <class InputIterator>
+	unordered_set(InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(), const key_equal& eq = key_equal(), const allocator_type& alloc = allocator_type())
+		: _table(n, hf, eq, alloc)
+	{
+		this->insert(first, last);
+	}
+
+	unordered_set(const unordered_set& x) : _table(x._table) {}
+
+	unordered_set& operator=(const unordered_set& x)
+	{
+		_table = x._table;
+		return (*this);
+	}
+
+#if __cplusplus >= 201103L
+	unordered_set(unordered_set&& x) noexcept : _table(std::move(x._table)) {}
+
+	unordered_set& operator=(unordered_set&& x) noexcept
+	{
+		_table = std::move(x._table);
+		return (*this);
+	}
+#endif
+
+	~unordered_set() {}
+
+	/*****************	ITERATOR	*********************/
+	iterator begin() const		{	return (_table.begin());	}
+	iterator end() const		{	return (_table.end());		}
+
+	/******************	CAPACITY	********************/
+	bool empty() const			{	return (_table.empty());	}
+	size_type size() const		{	return (_table.size());		}
+	size_type max_size() const	{	return (_table.max_size());	}
+
+	/******************	MODIFIER	********************/
+	ft::pair<iterator,bool> insert(const value_type& x)
+	{
+		return (result(_table.insert_value(x)));
+	}
+
+	iterator insert(const_iterator, const value_type& x)
+	{
+		return (insert(x).first);
+	}
+
+	template <class InputIterator>
+	void insert(InputIterator first, InputIterator last)
+	{
+		for (; first != last; ++first)
+			_table.insert_value(*first);
+	}
+
+#if __cplusplus >= 201103L
+	ft::pair<iterator,bool> insert(value_type&& x)
+	{
+		return (result(_table.insert_value(std::move(x))));
+	}
+
+	template <class... Args>
+	ft::pair<iterator,bool> emplace(Args&&... args)
+	{
+		return (result(_table.emplace(std::forward<Args>(args)...)));
+	}
+#endif
+
+	void erase(const_iterator position)
+	{
+		_table.erase_slot(_table.index(position));
+	}
+
+	size_type erase(const key_type& k)
+	{
+		return (_table.remove(k));
+	}
+
+	void erase(const_iterator first, const_iterator last)
+	{
+		while (first != last)
+			erase(first++);
+	}
+
+	void swap(unordered_set& x)		{	_table.swap(x._table);	}
+	void clear()					{	_table.clear();			}
+
+	/******************	LOOKUP	********************/
+	iterator find(const key_type& k) const			{	return (_table.to_iterator(_table.find(k)));	}
+	size_type count(const key_type& k) const		{	return (_table.contains(k));	}
+
+	ft::pair<iterator,iterator> equal_range(const key_type& k) const
+	{
+		iterator it = find(k);
+		return (ft::make_pair(it, (it == end()) ? it : ++iterator(it)));
+	}
+
+	/******************	HASH POLICY	********************
+	 * see ft::unordered_map
+	******************************************************/
+	size_type bucket_count() const			{	return (_table.capacity());			}
+	float load_factor() const				{	return (_table.load_factor());		}
+	float max_load_factor() const			{	return (_table.max_load_factor());	}
+	void max_load_factor(float ml)			{	_table.max_load_factor(ml);			}
+	void rehash(size_type n)				{	_table.rehash(n);					}
+	void reserve(size_type n)				{	_table.reserve(n);					}
+
+	/******************	OBSERVERS	********************/
+	hasher hash_function() const			{	return (_table.hash_function());	}
+	key_equal key_eq() const				{	return (_table.key_eq());			}
+	allocator_type get_allocator() const	{	return (_table.get_allocator());	}
+
+	private :
+	ft::pair<iterator,bool> result(const ft::pair<size_type, bool>& res) const
+	{
+		return (ft::make_pair(_table.to_iterator(res.first), res.second));
+	}
+};
+
+	/******************	NON MEMBER FUNC.	********************/
+	template <class Key, class Hash, class Pred, class Allocator>
+	bool operator== (const unordered_set<Key,Hash,Pred,Allocator>& lhs, const unordered_set<Key,Hash,Pred,Allocator>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		for (typename unordered_set<Key,Hash,Pred,Allocator>::const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+			if (rhs.find(*it) == rhs.end())
+				return (false);
+		return (true);
+	}
+
+	template <class Key, class Hash, class Pred, class Allocator>
+	bool operator!= (const unordered_set<Key,Hash,Pred,Allocator>& lhs, const unordered_set<Key,Hash,Pred,Allocator>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class Hash, class Pred, class Allocator>
+	void swap (unordered_set<Key,Hash,Pred,Allocator>& x, unordered_set<Key,Hash,Pred,Allocator>& y)
+	{
+		x.swap(y);
+	}
+};
+
+#endif
@@ -4,6 +4,9 @@
 #include <iostream>
 #include <algorithm>
 #include <memory>
+#include <cstring>
+#include <cstdlib>
+#include <new>
 #include <stdexcept>
 #include <iterator> //std::distance
 #include "../utlis/vec_iterator.hpp"
@@ -11,12 +14,15 @@
 #include "../utlis/type_traits.hpp"
 #include "../utlis/reverse_iterator.hpp"
 #include "../utlis/iterator_validity.hpp"
+#include "../utlis/relocate.hpp"
+#include "../utlis/growth_policy.hpp"
 #include <vector>
 
 namespace ft
 {
 
-	template <class T, class Allocator = std::allocator<T> >
+	// Growth picks the capacity when the vector is full, see growth_policy.hpp
+	template <class T, class Allocator = std::allocator<T>, class Growth = ft::growth_double>
 	class vector
 	{
 	public:
@@ -32,6 +38,7 @@ namespace ft
 		typedef ft::vec_iterator<const T>				 const_iterator;
 		typedef ft::reverse_iterator<iterator>			 reverse_iterator;
 		typedef ft::reverse_iterator<const_iterator>     const_reverse_iterator;
+		typedef Growth									 growth_policy;
 
 	protected:	
 		value_type*		_arr;
@@ -56,11 +63,12 @@ namespace ft
 
 		explicit vector (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()): _arr(0), _alloc(alloc), _size(n), _capacity(n)
 		{
-			_arr = _alloc.allocate(_capacity);
+			_arr = buf_allocate(_capacity);
 			for (size_type i = 0; i < _size; i++)
 				_alloc.construct(_arr + i, val);
 		}
 		
+		// sized up front for forward iterators, grown geometrically for single pass ones
 		template <class InputIterator>
 		vector (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = 0 ) : _arr(0),
 			_alloc(alloc),
@@ -68,17 +76,16 @@ namespace ft
 			_capacity(0) 
 		{
 			ft::check_range(first, last);
-			size_type range = 0;
-			for (InputIterator temp = first; temp != last; temp++) 
-				range++;
-			_arr = _alloc.allocate(range + 1);
-			for (size_type i = 0; i < range; i++)
+			try
 			{
-				_size++;
-				_alloc.construct(_arr + i, *first);
-				first++;
+				append_range(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+			}
+			catch (...)
+			{
+				clear();
+				buf_deallocate(_arr, _capacity);
+				throw;
 			}
-			_capacity = range;
 		}
 
 		vector (const vector& x): _arr(0), _alloc(x._alloc), _size(0), _capacity(0)
@@ -86,26 +93,50 @@ namespace ft
 			*this = x;
 		};
 		
+		// reuses the buffer when it is big enough
 		vector&	operator=(const vector& x) 
 		{
-			if (!this->empty())
-				this->~vector();
 			if (this != &x)
 			{
-				_arr = _alloc.allocate(x._capacity);
-				_size = x._size;
-				_capacity = x._capacity;
-				for (size_type i = 0; i < _size; i++) {
-					_alloc.construct(_arr + i, *(x._arr + i));
+				this->clear();
+				if (x._size > _capacity)
+				{
+					buf_deallocate(_arr, _capacity);
+					_arr = 0;
+					_capacity = 0;
+					_arr = buf_allocate(x._size);
+					_capacity = x._size;
 				}
+				for (; _size < x._size; _size++)
+					_alloc.construct(_arr + _size, *(x._arr + _size));
 			}
 			return *this;
 		};
 
+#if __cplusplus >= 201103L
+		// C++11: the buffer changes hands, x is left empty
+		vector(vector&& x) noexcept : _arr(x._arr), _alloc(x._alloc), _size(x._size), _capacity(x._capacity)
+		{
+			x._arr = 0;
+			x._size = 0;
+			x._capacity = 0;
+		}
+
+		vector& operator=(vector&& x) noexcept
+		{
+			if (this != &x)
+			{
+				this->clear();
+				this->swap(x);
+			}
+			return *this;
+		}
+#endif
+
 		~vector()
 		{
 			clear();
-			_alloc.deallocate(_arr, _capacity);
+			buf_deallocate(_arr, _capacity);
 			_capacity = 0;
 			_size = 0;
 		}
@@ -147,7 +178,7 @@ namespace ft
 			if (n > this->max_size()) 
 				throw std::length_error("ft::vector::resize");
 			else if (n > _capacity)
-				this->reserve(std::max(_capacity * 2, n));
+				this->reserve(next_capacity(n));
 			for (size_type i = _size; i < n; i++)
 				_alloc.construct(_arr + i, val);
 			for (size_type i = _size; i > n; i--)
@@ -162,24 +193,27 @@ namespace ft
 			return (false);
 		}
 
+		// elements are relocated, not copied: see ft::uninitialized_relocate
 		void reserve(size_type n){
 			if (n > max_size())
 					throw std::length_error("exceeds maximum supported size");
 			if (n > _capacity)
+				reallocate(n);
+		}
+
+		// gives the unused capacity back
+		void shrink_to_fit()
+		{
+			if (_capacity == _size)
+				return ;
+			if (_size == 0)
 			{
-				allocator_type	t_alloc;
-				pointer 		temp 	= t_alloc.allocate(n);
-				size_type		t_size	= _size;
-
-				for (size_type i = 0; i < _size; i++)
-					t_alloc.construct(temp + i, *(_arr + i));
-				this->~vector();
-				
-				_arr	  = temp;
-				_alloc	  = t_alloc;
-				_size	  = t_size;
-				_capacity = n;
+				buf_deallocate(_arr, _capacity);
+				_arr = 0;
+				_capacity = 0;
+				return ;
 			}
+			reallocate(_size);
 		}
 		
 
@@ -222,17 +256,91 @@ namespace ft
 		* swap			swaps content	
 		* clear			clears content
 		******************************************************/
+		// when full, value is built in the new buffer before the old one goes (it may be one of ours);
+		// a buffer grown in place keeps no old copy, so value is taken aside first, if it is one of ours
 		void push_back(const value_type &value) 
 		{
-			if (!_capacity)
-				this->reserve(1);
-			else if (_size == _capacity)
-				this->reserve(_capacity * 2);
-		
+			if (_size == _capacity && in_place)
+			{
+				if (&value >= _arr && &value < _arr + _size)
+				{
+					value_type copy(value);
+
+					reserve(next_capacity(_size + 1));
+					_alloc.construct(_arr + _size, FT_MOVE(copy));
+				}
+				else
+				{
+					reserve(next_capacity(_size + 1));
+					_alloc.construct(_arr + _size, value);
+				}
+				_size++;
+				return ;
+			}
+			if (_size == _capacity)
+				return (realloc_insert(_size, repeat(value), 1));
 			_alloc.construct(_arr + _size, value);
 			_size++;
 		}
 
+#if __cplusplus >= 201103L
+		/******************		C++11	******************
+		* push_back		an rvalue is moved in
+		* emplace_back	builds the element in place from args
+		* emplace		same, anywhere: at the end or into a new buffer the
+		 				element is built in place, in the middle it is built
+						aside first (args may refer to elements that move)
+		* insert		an rvalue is moved in
+		**************************************************/
+		void push_back(value_type&& value)
+		{
+			emplace_back(std::move(value));
+		}
+
+		template <class... Args>
+		reference emplace_back(Args&&... args)
+		{
+			if (_size == _capacity && in_place)
+			{
+				value_type tmp(std::forward<Args>(args)...);
+
+				reserve(next_capacity(_size + 1));
+				_alloc.construct(_arr + _size, std::move(tmp));
+				_size++;
+			}
+			else if (_size == _capacity)
+				realloc_emplace(_size, std::forward<Args>(args)...);
+			else
+			{
+				_alloc.construct(_arr + _size, std::forward<Args>(args)...);
+				_size++;
+			}
+			return (_arr[_size - 1]);
+		}
+
+		template <class... Args>
+		iterator emplace(iterator position, Args&&... args)
+		{
+			size_type pos = position - this->begin();
+
+			if (pos == _size)
+				emplace_back(std::forward<Args>(args)...);
+			else if (_size == _capacity)
+				realloc_emplace(pos, std::forward<Args>(args)...);
+			else
+			{
+				value_type tmp(std::forward<Args>(args)...);
+				insert_n(pos, std::make_move_iterator(&tmp), 1);
+			}
+			return (this->begin() + pos);
+		}
+
+		iterator insert(iterator position, value_type&& val)
+		{
+			return (emplace(position, std::move(val)));
+		}
+#endif
+
 		void pop_back()	
 		{	
 			_alloc.destroy(&_arr[_size - 1]);
@@ -241,23 +349,29 @@ namespace ft
 
 		iterator erase (iterator position)
 		{
-			for (iterator i = position; i != this->end() - 1; i++)
-				*i = *(i + 1);
-			_alloc.destroy(_arr + _size - 1);
-			_size--;
-			return position;
+			return (this->erase(position, position + 1));
 		}
 
+		// the tail moves down once: one memmove for trivially relocatable types, move assignment otherwise
 		iterator erase(iterator first, iterator last)
 		{
-			size_type diff1 = first - this->begin();
-			size_type diff2 = last - this->begin();
-			size_type d = last - first;
-			size_type j = 0;
-
-			for (size_type i = diff1; diff2 + j < _size; i++)
-					_arr[i] = _arr[diff2 + j++];
-
+			pointer		p		= first.base();
+			pointer		q		= last.base();
+			pointer		end		= _arr + _size;
+			size_type	d		= q - p;
+
+			if (d == 0)
+				return first;
+			if (ft::is_trivially_relocatable<value_type>::value)
+			{
+				for (pointer it = p; it != q; ++it)
+					_alloc.destroy(it);
+				std::memmove(static_cast<void*>(p), static_cast<const void*>(q), (end - q) * sizeof(value_type));
+				_size -= d;
+				return first;
+			}
+			for (; q != end; ++p, ++q)
+				*p = FT_MOVE(*q);
 			for (size_type i = 0; i < d; i++)
 				_alloc.destroy(_arr + --_size);
 			return first;
@@ -273,119 +387,39 @@ namespace ft
 		template <class InputIterator>
 		void assign(InputIterator first, InputIterator last, typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)
 		{
-			size_type n = std::distance(first, last);
-			if (n > _capacity)
-				reserve(n);
-			for (size_type i = 0; i < n; i++)
-				_alloc.construct(_arr + i, *first++);
-			_size = n;
+			this->clear();
+			append_range(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 		}
 
 		void assign (size_type n, const value_type& val)
 		{
+			this->clear();
 			if (n > _capacity)
 				reserve (n);
-			for (size_type i = 0; i < n; i++)	
-				_alloc.construct(_arr + i, val);
-			_size = n;
+			for (; _size < n; _size++)	
+				_alloc.construct(_arr + _size, val);
 		}
 
 		iterator insert(iterator position, const value_type &val) 
 		{
-			difference_type d = position - this->begin();
-			if (d >= 0) 
-			{
-				if (!_capacity)
-					reserve(1);
-				else if (_size == _capacity)
-					reserve(_capacity * 2);
-
-				if (static_cast<size_type>(d) > _size)
-					_alloc.construct(_arr + _size, *(_arr + _size - 1));
-				else 
-				{
-					for (size_type i = _size; i > static_cast<size_type>(d); i--) 
-					{
-						_alloc.construct(_arr + i, *(_arr + i - 1));
-						_alloc.destroy(_arr + i - 1);
-					}
-					_alloc.construct(_arr + size_type(d), val);
-				}
-			}
-			_size++;
-			return position;
+			size_type pos = position - this->begin();
+
+			this->insert(position, 1, val);
+			return (this->begin() + pos);
 		}
 
+		// val may live in this vector: keep a copy before anything moves
 		void insert(iterator position, size_type n, const value_type &val) 
 		{
-			difference_type d	= position - this->begin();
-			size_type new_size 	= _size + n;
-
-			if (_size + n >= _capacity)
-				this->reserve(std::max(_capacity * 2, _size + n));
+			value_type copy(val);
 
-			allocator_type t_alloc;
-			pointer		   temp = t_alloc.allocate(_size);
-			for (size_type i = 0; i < _size; i++) 
-				t_alloc.construct(temp + i, *(_arr + i));
-
-			for (size_type i = static_cast<size_type>(d) + n; i < new_size; i++)
-			{
-				if (i < _size)
-					_alloc.destroy(_arr + i);
-				_alloc.construct(_arr + i, *(temp + i - n));
-			}
-			for (size_type i = d; i < static_cast<size_type>(d) + n; i++)
-			{
-				if (i < _size)
-					_alloc.destroy(_arr + i);
-				_alloc.construct(_arr + i, val);
-			}
-			for (size_type i = 0; i < _size; i++)
-				t_alloc.destroy(temp + i);
-			t_alloc.deallocate(temp, _size);
-			_size += n;
+			insert_n(position - this->begin(), repeat(copy), n);
 		}
 
 		template <class InputIterator>
 		void insert(iterator position, InputIterator first, InputIterator last, typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = 0)
 		{
-			difference_type d 	  = position - this->begin();
-			difference_type range = d;
-			size_type 		n	  = 0;
-
-			for (InputIterator temp = first; temp != last; temp++) 
-			{
-				range++;
-				n++;
-			}
-			if (_size + n >= _capacity)
-				this->reserve(std::max(_capacity * 2, _size + n));
-
-			allocator_type t_alloc;
-			pointer 	   temp = t_alloc.allocate(_size);
-
-			for (size_type i = 0; i < _size; i++)
-				t_alloc.construct(temp + i, *(_arr + i));
-
-			for (size_type i = static_cast<size_type>(range); i < _size + n; i++)
-			{
-				if (i < _size)
-					_alloc.destroy(_arr + i);
-				_alloc.construct(_arr + i, *(temp + i + static_cast<size_type>(d - range)));
-			}
-
-			for (size_type i = static_cast<size_type>(d); i < static_cast<size_type>(range); i++)
-			{
-				if (i < _size)
-					_alloc.destroy(_arr + i);
-				_alloc.construct(_arr + i, *first++);
-			}
-
-			for (size_type i = 0; i < _size; i++)
-				t_alloc.destroy(temp + i);
-			t_alloc.deallocate(temp, _size);
-			_size += n;
+			insert_range(position - this->begin(), first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 		}
 		
 		void swap(vector& x) {
@@ -408,46 +442,401 @@ namespace ft
 		allocator_type get_allocator() const {
 			return _alloc;
 		}
+
+	private:
+		/******************		BUFFER	******************
+		* trivially relocatable elements with the default allocator live in
+		  malloc'd memory, so a new capacity is a realloc: the allocator can
+		  extend the block where it is, and glibc moves large (mmap'd) blocks
+		  with mremap, so their pages are remapped instead of copied.
+		* every other vector goes through _alloc and relocates
+		**************************************************/
+		static const bool in_place = ft::is_trivially_relocatable<value_type>::value
+									&& ft::is_same<allocator_type, std::allocator<value_type> >::value;
+
+		pointer buf_allocate(size_type n)
+		{
+			if (!in_place)
+				return (_alloc.allocate(n));
+			if (n == 0)
+				return (0);
+			if (n > max_size())
+				throw std::bad_alloc();
+			void* p = std::malloc(n * sizeof(value_type));
+			if (p == 0)
+				throw std::bad_alloc();
+			return (static_cast<pointer>(p));
+		}
+
+		void buf_deallocate(pointer p, size_type n)
+		{
+			if (in_place)
+				std::free(static_cast<void*>(p));
+			else if (p != 0)
+				_alloc.deallocate(p, n);
+		}
+
+		// capacity becomes n (n >= _size, n > 0)
+		void reallocate(size_type n)
+		{
+			if (in_place)
+			{
+				void* p = std::realloc(static_cast<void*>(_arr), n * sizeof(value_type));
+				if (p == 0)
+					throw std::bad_alloc();
+				_arr = static_cast<pointer>(p);
+				_capacity = n;
+				return ;
+			}
+
+			pointer temp = buf_allocate(n);
+
+			try
+			{
+				ft::uninitialized_relocate(_alloc, _arr, _arr + _size, temp);
+			}
+			catch (...)
+			{
+				buf_deallocate(temp, n);
+				throw;
+			}
+			buf_deallocate(_arr, _capacity);
+			_arr	  = temp;
+			_capacity = n;
+		}
+
+		// what Growth asks for, never more than max_size()
+		size_type next_capacity(size_type required) const
+		{
+			size_type cap = Growth::grow(_capacity, required, sizeof(value_type));
+
+			if (cap > max_size() || cap < required)
+				cap = std::max(required, std::min(cap, max_size()));
+			return (cap);
+		}
+
+		// an endless run of one value, so the fill insert can share the range code
+		struct repeat
+		{
+			const value_type*	v;
+
+			explicit repeat(const value_type& x) : v(&x) {}
+			const value_type& operator*() const	{	return (*v);	}
+			repeat& operator++()				{	return (*this);	}
+		};
+
+		/******************		RANGE HELPERS	******************
+		* picked by iterator category (std or ft tags)
+		* append_range		forward iterators are measured first and fill one
+		 					allocation of exactly the right size; single pass
+							iterators are read once, growing geometrically
+		* insert_range		single pass input is buffered first, unless it goes
+		 					at the end, so the tail still moves only once
+		**********************************************************/
+		template <class It>
+		void append_range(It first, It last, std::input_iterator_tag)
+		{
+			for (; first != last; ++first)
+				this->push_back(*first);
+		}
+
+		template <class It>
+		void append_range(It first, It last, ft::input_iterator_tag)
+		{
+			append_range(first, last, std::input_iterator_tag());
+		}
+
+		template <class It>
+		void append_range(It first, It last, std::forward_iterator_tag)
+		{
+			size_type n = ft::distance(first, last);
+
+			if (_size + n > _capacity)
+				reserve(_size + n);
+			for (; first != last; ++first, ++_size)
+				_alloc.construct(_arr + _size, *first);
+		}
+
+		template <class It>
+		void append_range(It first, It last, ft::forward_iterator_tag)
+		{
+			append_range(first, last, std::forward_iterator_tag());
+		}
+
+		template <class It>
+		void insert_range(size_type pos, It first, It last, std::input_iterator_tag)
+		{
+			if (pos == _size)
+				return (append_range(first, last, std::input_iterator_tag()));
+
+			vector tmp(first, last, _alloc);
+			insert_n(pos, tmp._arr, tmp._size);
+		}
+
+		template <class It>
+		void insert_range(size_type pos, It first, It last, ft::input_iterator_tag)
+		{
+			insert_range(pos, first, last, std::input_iterator_tag());
+		}
+
+		template <class It>
+		void insert_range(size_type pos, It first, It last, std::forward_iterator_tag)
+		{
+			insert_n(pos, first, ft::distance(first, last));
+		}
+
+		template <class It>
+		void insert_range(size_type pos, It first, It last, ft::forward_iterator_tag)
+		{
+			insert_n(pos, first, ft::distance(first, last));
+		}
+
+		/******************		INSERT HELPERS	******************
+		* insert_n			puts n values read from src at pos. with enough capacity the tail
+		 					is shifted once in place (one memmove for trivially relocatable types),
+							otherwise the old elements are relocated around the gap into a new buffer
+		* realloc_insert	the reallocating half of insert_n
+		**********************************************************/
+		template <class It>
+		void insert_n(size_type pos, It src, size_type n)
+		{
+			if (n == 0)
+				return ;
+			if (n > _capacity - _size)
+				return (realloc_insert(pos, src, n));
+
+			pointer		p		= _arr + pos;
+			pointer		old_end	= _arr + _size;
+			size_type	after	= _size - pos;
+			size_type	i		= 0;
+
+			if (ft::is_trivially_relocatable<value_type>::value)
+			{
+				std::memmove(static_cast<void*>(p + n), static_cast<const void*>(p), after * sizeof(value_type));
+				try
+				{
+					for (; i < n; ++i, ++src)
+						_alloc.construct(p + i, *src);
+				}
+				catch (...)
+				{
+					while (i > 0)
+						_alloc.destroy(p + --i);
+					std::memmove(static_cast<void*>(p), static_cast<const void*>(p + n), after * sizeof(value_type));
+					throw;
+				}
+				_size += n;
+				return ;
+			}
+			if (after > n)
+			{
+				// last n elements go to raw storage, the rest of the tail is shifted by assignment
+				construct_tail(old_end - n, old_end);
+				for (pointer from = old_end - n, to = old_end; from != p; )
+					*--to = FT_MOVE(*--from);
+				for (; i < n; ++i, ++src)
+					p[i] = *src;
+				return ;
+			}
+			// values past the old end are constructed, the ones before it assigned
+			It mid = src;
+			for (size_type k = 0; k < after; ++k)
+				++mid;
+			try
+			{
+				for (; i < n - after; ++i, ++mid)
+					_alloc.construct(old_end + i, *mid);
+				_size += i;
+				construct_tail(p, old_end);
+			}
+			catch (...)
+			{
+				while (i > 0)
+					_alloc.destroy(old_end + --i);
+				_size = pos + after;
+				throw;
+			}
+			for (i = 0; i < after; ++i, ++src)
+				p[i] = *src;
+		}
+
+		// copies (moves in C++11) [first, last) to the raw slots at _arr + _size
+		void construct_tail(pointer first, pointer last)
+		{
+			pointer end = _arr + _size;
+			pointer cur = end;
+
+			try
+			{
+				for (; first != last; ++first, ++cur)
+					_alloc.construct(cur, FT_MOVE(*first));
+			}
+			catch (...)
+			{
+				while (cur != end)
+					_alloc.destroy(--cur);
+				throw;
+			}
+			_size += cur - end;
+		}
+
+		template <class It>
+		void realloc_insert(size_type pos, It src, size_type n)
+		{
+			if (n > max_size() - _size)
+				throw std::length_error("vector::insert");
+
+			size_type	cap = next_capacity(_size + n);
+			pointer		buf = buf_allocate(cap);
+			size_type	i	= 0;
+
+			try
+			{
+				for (; i < n; ++i, ++src)
+					_alloc.construct(buf + pos + i, *src);
+				ft::uninitialized_relocate_around(_alloc, _arr, _arr + pos, _arr + _size, buf, n);
+			}
+			catch (...)
+			{
+				while (i > 0)
+					_alloc.destroy(buf + pos + --i);
+				buf_deallocate(buf, cap);
+				throw;
+			}
+			buf_deallocate(_arr, _capacity);
+			_arr		= buf;
+			_size		+= n;
+			_capacity	= cap;
+		}
+
+#if __cplusplus >= 201103L
+		// realloc_insert for a single element built from args
+		template <class... Args>
+		void realloc_emplace(size_type pos, Args&&... args)
+		{
+			if (_size == max_size())
+				throw std::length_error("vector::emplace");
+
+			size_type	cap = next_capacity(_size + 1);
+			pointer		buf = buf_allocate(cap);
+
+			try
+			{
+				_alloc.construct(buf + pos, std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				buf_deallocate(buf, cap);
+				throw;
+			}
+			try
+			{
+				ft::uninitialized_relocate_around(_alloc, _arr, _arr + pos, _arr + _size, buf, 1);
+			}
+			catch (...)
+			{
+				_alloc.destroy(buf + pos);
+				buf_deallocate(buf, cap);
+				throw;
+			}
+			buf_deallocate(_arr, _capacity);
+			_arr		= buf;
+			_size		+= 1;
+			_capacity	= cap;
+		}
+#endif
+	};
+
+	// a vector is only a pointer to its heap buffer, moving it moves nothing else
+	template <class T, class Growth>
+	struct is_trivially_relocatable<ft::vector<T, std::allocator<T>, Growth> >
+	{
+		static const bool value = true;
 	};
 
 	/**************		NON MEMBER FUNC.	***************
 	* swap	
 	* relational operators
 	*******************************************************/
-	template <class T, class Alloc>
-	void swap (vector<T,Alloc>& x, vector<T,Alloc>& y){
+	template <class T, class Alloc, class Growth>
+	void swap (vector<T,Alloc,Growth>& x, vector<T,Alloc,Growth>& y){
 		x.swap(y);
 	};
 
-	template <class T, class Alloc>
-	bool operator==(const vector<T,Alloc>& l, const vector<T,Alloc>& r){
+	/**************		ERASE_IF / ERASE	***************
+	* remove every element matching pred / equal to value in one
+	* pass: kept elements move down once, the tail is erased at the end.
+	* returns how many were removed
+	*******************************************************/
+	template <class T, class Alloc, class Growth, class Predicate>
+	typename vector<T,Alloc,Growth>::size_type erase_if(vector<T,Alloc,Growth>& v, Predicate pred)
+	{
+		typename vector<T,Alloc,Growth>::iterator	it	= v.begin();
+		typename vector<T,Alloc,Growth>::iterator	end	= v.end();
+
+		while (it != end && !pred(*it))
+			++it;
+		if (it == end)
+			return (0);
+		typename vector<T,Alloc,Growth>::iterator	out	= it;
+		for (++it; it != end; ++it)
+		{
+			if (!pred(*it))
+			{
+				*out = FT_MOVE(*it);
+				++out;
+			}
+		}
+		typename vector<T,Alloc,Growth>::size_type	n	= end - out;
+		v.erase(out, end);
+		return (n);
+	}
+
+	template <class U>
+	struct equal_to_value
+	{
+		const U*	v;
+
+		explicit equal_to_value(const U& x) : v(&x) {}
+		template <class T>
+		bool operator()(const T& x) const	{	return (x == *v);	}
+	};
+
+	template <class T, class Alloc, class Growth, class U>
+	typename vector<T,Alloc,Growth>::size_type erase(vector<T,Alloc,Growth>& v, const U& value)
+	{
+		return (ft::erase_if(v, equal_to_value<U>(value)));
+	}
+
+	template <class T, class Alloc, class Growth>
+	bool operator==(const vector<T,Alloc,Growth>& l, const vector<T,Alloc,Growth>& r){
 		if (l.size() != r.size())
 			return false;
 		return ft::equal(l.begin(), l.end(), r.begin());
 	};
 
-	template <class T, class Alloc>
-	bool operator!=(const vector<T,Alloc>& l, const vector<T,Alloc>& r){
+	template <class T, class Alloc, class Growth>
+	bool operator!=(const vector<T,Alloc,Growth>& l, const vector<T,Alloc,Growth>& r){
 		return !(l == r);
 	};
 
-	template <class T, class Alloc>
-	bool operator<(const vector<T,Alloc>& l, const vector<T,Alloc>& r){
+	template <class T, class Alloc, class Growth>
+	bool operator<(const vector<T,Alloc,Growth>& l, const vector<T,Alloc,Growth>& r){
 		return ft::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end());
 	};
 
-	template <class T, class Alloc>
-	bool operator>(const vector<T,Alloc>& l, const vector<T,Alloc>& r){
+	template <class T, class Alloc, class Growth>
+	bool operator>(const vector<T,Alloc,Growth>& l, const vector<T,Alloc,Growth>& r){
 		return (r < l);
 	};
 
-	template <class T, class Alloc>
-	bool operator<=(const vector<T,Alloc>& l, const vector<T,Alloc>& r){
+	template <class T, class Alloc, class Growth>
+	bool operator<=(const vector<T,Alloc,Growth>& l, const vector<T,Alloc,Growth>& r){
 		return !(l > r);
 	};
 
-	template <class T, class Alloc>
-	bool operator>=(const vector<T,Alloc>& l, const vector<T,Alloc>& r){
+	template <class T, class Alloc, class Growth>
+	bool operator>=(const vector<T,Alloc,Growth>& l, const vector<T,Alloc,Growth>& r){
 		return !(l < r);
 	};
 };
@@ -3,25 +3,37 @@
 
 #include <functional>
 #include <memory>
+#include <algorithm>
 #include "map_iterator.hpp"
 #include "reverse_iterator.hpp"
 #include "iterator_traits.hpp"
 #include "pair.hpp"
 #include "node.hpp"
+#include "node_pool.hpp"
+#include "type_traits.hpp"
+#include "key_extract.hpp"
 
 namespace ft
 {
-    template <class T, class Compare = std::less<typename T::first_type>, class Allocator = std::allocator<T> > 
+    /*********************************************
+    * KeyOfValue finds the key in a value (see
+    * key_extract.hpp). with Multi equal keys are
+    * kept, each new one after those already there;
+    * otherwise an insert finds the existing node
+    *********************************************/
+    template <class Key, class T, class KeyOfValue, class Compare = std::less<Key>, class Allocator = std::allocator<T>, bool Multi = false>
     class AVL
     {
         public:
             typedef T                                                               value_type;
-            typedef typename value_type::first_type                                 key;
-            typedef typename value_type::second_type                                value;
+            typedef Key                                                             key;
+            typedef typename KeyOfValue::mapped_type                                value;
             typedef ft::AVLNODE<const T>                                            const_node;
+            typedef ft::AVLNODE<T>*                                                 node_pointer;
 			
             typedef Allocator                                                       base_alloc;
             typedef typename Allocator::template rebind<ft::AVLNODE<T> >::other     node_alloc;
+            typedef ft::node_pool<ft::AVLNODE<T>, node_alloc>                       pool;
            
             typedef ft::map_iterator<T, ft::AVLNODE<T>, Compare, AVL>               iterator;
             typedef ft::map_iterator<const T, const ft::AVLNODE<T>, Compare, AVL>   const_iterator;
@@ -30,61 +42,177 @@ namespace ft
        
         private:
             ft::AVLNODE<T>* _node;
-            node_alloc      n_alloc;
+            ft::AVLNODE<T>* _header;    // end(): left is the leftmost node, right the rightmost,
+                                        // bf is 1 once every sz is kept exact (see counting()).
+                                        // 0 in a tree moved from, until its first node
+            pool            _pool;
             base_alloc      b_alloc;
             int             _size;
             Compare         _comp;
 
         public : 
-            AVL() : _node(0), _size(0) {}
+            explicit AVL(const Compare& comp = Compare(), const Allocator& alloc = Allocator()) : _node(0), _header(0), _pool(node_alloc(alloc)), b_alloc(alloc), _size(0), _comp(comp)
+            {
+                _header = newHeader();
+            }
+
+            AVL(const AVL &x) : _node(0), _header(0), _pool(x._pool.get_allocator()), b_alloc(x.b_alloc), _size(0), _comp(x._comp)
+            {
+                _header = newHeader();
+                try
+                {
+                    assign(x);
+                }
+                catch (...)
+                {
+                    _pool.get_allocator().deallocate(_header, 1);
+                    throw;
+                }
+            }
+
+            ~AVL()
+            {
+                delete_all();
+                if (_header != 0)
+                    _pool.get_allocator().deallocate(_header, 1);
+            }
 
-            AVL(const AVL &x) : _node(0)
+            AVL& operator=(const AVL& x)
             {
-                *this = assign(x);
+                if (this != &x)
+                    assign(x);
+                return (*this);
             }
 
-            ~AVL() {}
+#if __cplusplus >= 201103L
+            // C++11: the nodes and the header change hands, nothing is allocated.
+            // x is left empty without a header, and gets one back with its first node
+            AVL(AVL&& x) noexcept : _node(0), _header(0), _pool(x._pool.get_allocator()), b_alloc(x.b_alloc), _size(0), _comp(x._comp)
+            {
+                swap(x);
+            }
 
+            AVL& operator=(AVL&& x) noexcept
+            {
+                if (this != &x)
+                {
+                    delete_all();
+                    swap(x);
+                }
+                return (*this);
+            }
+#endif
+
+            /*********************************************
+            * x is already sorted and unique: its values are
+            * copied in order into one chunk of this tree's
+            * pool and linked into a balanced tree in O(n)
+            *********************************************/
             AVL& assign(AVL const &x)
             {
                 delete_all();
-                n_alloc = x.n_alloc;
                 b_alloc = x.b_alloc;
                 _comp	= x._comp;
-                for (const_iterator it = x.begin(); it != x.end(); it++)
-                    insert(*it);
-                _size	= x._size;
+                _pool.reserve(x._size);
+                ft::AVLNODE<T>* list = 0;
+                ft::AVLNODE<T>* tail = 0;
+                size_t          n = 0;
+                try
+                {
+                    for (const_iterator it = x.begin(); it != x.end(); ++it, ++n)
+                        append(&list, &tail, newNode(*it));
+                }
+                catch (...)
+                {
+                    free_list(list);
+                    throw;
+                }
+                link_sorted(list, tail, n);
                 return (*this);
             }
 
+            /*********************************************
+            * range insert. into an empty tree the leading
+            * ascending run (strictly, unless Multi) is bulk built in O(n),
+            * whatever is left goes in with an end() hint
+            *********************************************/
+            template <class InputIterator>
+            void insert_range(InputIterator first, InputIterator last)
+            {
+                if (_node == 0)
+                {
+                    ft::AVLNODE<T>* list = 0;
+                    ft::AVLNODE<T>* tail = 0;
+                    size_t          n = 0;
+                    try
+                    {
+                        for (; first != last; ++first, ++n)
+                        {
+                            if (tail != 0 && (Multi ? _comp(key_of(*first), key_of(tail->_data)) : !_comp(key_of(tail->_data), key_of(*first))))
+                                break;
+                            append(&list, &tail, newNode(*first));
+                        }
+                    }
+                    catch (...)
+                    {
+                        free_list(list);
+                        throw;
+                    }
+                    link_sorted(list, tail, n);
+                }
+                for (; first != last; ++first)
+                    insert_hint(_header, *first);
+            }
+
 			void delete_node(ft::AVLNODE<T> *node)
             {
-                b_alloc.destroy(node->_data);
-                b_alloc.deallocate(node->_data, 1 * sizeof(T*));
-                node->_data = NULL;
-				// n_alloc.destroy(node);
-                n_alloc.deallocate(node, 1 * sizeof(ft::AVLNODE<T> *));
-                node = NULL;
+                b_alloc.destroy(&node->_data);
+                _pool.deallocate(node);
             }
 
+			/*********************************************
+			* only runs the destructors, the memory goes back
+			* with the pool. post-order walk without recursion:
+			* a leaf is destroyed and cut from its parent, so
+			* the parent becomes a leaf in turn
+			*********************************************/
 			ft::AVLNODE<T>* delete_tree(ft::AVLNODE<T>* x)
             {
-                if (x->_data != 0)
-                {
+				while (x != 0)
+				{
 					if (x->left != 0)
-						delete_tree(x->left);
-					if (x->right != 0)
-						delete_tree(x->right);
-                    delete_node(x);
-                }
+						x = x->left;
+					else if (x->right != 0)
+						x = x->right;
+					else
+					{
+						ft::AVLNODE<T>* parent = x->parent;
+						b_alloc.destroy(&x->_data);
+						if (parent != 0 && parent->left == x)
+							parent->left = 0;
+						else if (parent != 0)
+							parent->right = 0;
+						x = parent;
+					}
+				}
                 return 0;
             }
 
+            /*********************************************
+            * bulk clear: values with a trivial destructor
+            * are not even visited, the chunks are dropped
+            *********************************************/
             void delete_all()
             {
-				if (_node)
-					_node = delete_tree(getRoot());
+				if (_node && !ft::is_trivially_destructible<T>::value)
+					delete_tree(getRoot());
+				_node = 0;
+				_pool.release();
                 _size = 0;
+                if (_header == 0)
+                    return ;
+                _header->left = _header;
+                _header->right = _header;
             }
 
             void clear()
@@ -95,7 +223,7 @@ namespace ft
 
             int size() const        {   return (_size);                 }
 
-            size_t max_size() const {   return (n_alloc.max_size());    }
+            size_t max_size() const {   return (_pool.max_size());      }
 
             bool empty() const       
 			{
@@ -104,25 +232,15 @@ namespace ft
                 return false;
             }
 
-            // end and begin
-            iterator begin() 
-            {
-                ft::AVLNODE<T> *first = find(findMin(_node).first);
-                return (iterator(first, this));
-            }
-            iterator end() 
-            {
-                return (iterator(NULL, this)); 
-            }
-            const_iterator begin() const 
-            { 
-                ft::AVLNODE<T> *first = find(findMin(_node).first);
-                return (iterator(first, this));
-            }
-            const_iterator end() const 
-            { 
-                return (iterator(NULL, this)); 
-            }
+            // end and begin, both read off the header
+            iterator begin()                {   return (iterator(leftmost(), this));            }
+            iterator end()                  {   return (iterator(_header, this));               }
+            const_iterator begin() const    {   return (const_iterator(leftmost(), this));      }
+            const_iterator end() const      {   return (const_iterator(_header, this));         }
+
+            // a missing node (0) becomes end()
+            iterator to_iterator(ft::AVLNODE<T>* node)              {   return (iterator((node) ? node : _header, this));         }
+            const_iterator to_iterator(ft::AVLNODE<T>* node) const  {   return (const_iterator((node) ? node : _header, this));   }
 
             // rend and rbegin
             reverse_iterator rbegin()   {   return reverse_iterator(end()); }
@@ -157,201 +275,885 @@ namespace ft
                 return (x);
             }
 
-            ft::AVLNODE<T>* newNode(T x)
+            // links only, the value part of the header is never built
+            ft::AVLNODE<T>* newHeader()
+            {
+                ft::AVLNODE<T>* node = _pool.get_allocator().allocate(1);
+
+                node->parent = 0;
+                node->left = node;
+                node->right = node;
+                node->ht = -1;
+                node->bf = 0;
+                node->sz = 0;
+                return (node);
+            }
+
+            // one raw node, the value is built in place inside it
+#if __cplusplus >= 201103L
+            template <class... Args>
+            ft::AVLNODE<T>* newNode(Args&&... args)
             {
-                ft::AVLNODE<T>* node = n_alloc.allocate(1 * sizeof(ft::AVLNODE<T>*));
-                node->_data = b_alloc.allocate(1 *  sizeof(T*));
-                b_alloc.construct(node->_data, x);
+                ft::AVLNODE<T>* node = _pool.allocate();
+                try
+                {
+                    b_alloc.construct(&node->_data, std::forward<Args>(args)...);
+                }
+#else
+            ft::AVLNODE<T>* newNode(const T& x)
+            {
+                ft::AVLNODE<T>* node = _pool.allocate();
+                try
+                {
+                    b_alloc.construct(&node->_data, x);
+                }
+#endif
+                catch (...)
+                {
+                    _pool.deallocate(node);
+                    throw;
+                }
+				node->parent = 0;
 				node->left = 0;
 				node->right = 0;
+				node->ht = 0;
+				node->bf = 0;
+				node->sz = 1;
                 return (node);
             }
 
-            int height()
+            // cached at the root, leaf has height 0
+            int height() const
             {
-                int ht = 0;
-
-                if (_node != 0)
-                    ht = height(_node) - 1;
-                return (ht);
+                if (_node == 0)
+                    return (-1);
+                return (_node->ht);
             }
 
-			bool contains(key k) const
+			bool contains(const key& k) const
+			{
+				return (find(k) != 0);
+			}
+
+			// a walk over the equal keys from the first one
+			size_t count(const key& k) const
+			{
+				size_t n = 0;
+
+				for (ft::AVLNODE<T>* x = find(k); x != 0 && !_comp(k, key_of(x->_data)); x = successor(x))
+					n++;
+				return (n);
+			}
+
+			bool insert(const T& x)
+			{
+				return (insert_value(x).second);
+			}
+
+			/*********************************************
+			* one descent: returns the node holding the key
+			* and whether it had to be created (always, with Multi)
+			*********************************************/
+			ft::pair<ft::AVLNODE<T>*, bool> insert_value(const T& x)
+			{
+				return (insert_hint(0, x));
+			}
+
+			/*********************************************
+			* map only (value is the mapped type):
+			* find_or_insert	mapped value is default constructed only if the key is new
+			* insert_unique		(k, *v) only if k is new
+			*********************************************/
+			ft::pair<ft::AVLNODE<T>*, bool> find_or_insert(const key& k)
+			{
+				return (insert_unique(k, 0));
+			}
+
+			ft::pair<ft::AVLNODE<T>*, bool> insert_unique(const key& k, const value* v)
+			{
+				ft::AVLNODE<T>*	parent;
+				bool			left;
+				ft::AVLNODE<T>*	found = descend(k, &parent, &left);
+
+				if (found != 0)
+					return (ft::make_pair(found, false));
+				ft::AVLNODE<T>* node = (v) ? newNode(T(k, *v)) : newNode(T(k, value()));
+				return (ft::make_pair(link(parent, left, node), true));
+			}
+
+			/*********************************************
+			* hint is the node x should go right before
+			* (the header meaning end(), 0 no hint), see slot()
+			*********************************************/
+			ft::pair<ft::AVLNODE<T>*, bool> insert_hint(ft::AVLNODE<T>* hint, const T& x)
+			{
+				ft::AVLNODE<T>*	parent;
+				bool			left;
+				ft::AVLNODE<T>*	found = slot(hint, key_of(x), &parent, &left);
+
+				if (found != 0)
+					return (ft::make_pair(found, false));
+				return (ft::make_pair(link(parent, left, newNode(x)), true));
+			}
+
+#if __cplusplus >= 201103L
+			/*********************************************
+			* C++11: x is moved into the node, and only
+			* when its key is new
+			*********************************************/
+			ft::pair<ft::AVLNODE<T>*, bool> insert_value(T&& x)
+			{
+				return (insert_hint(0, std::move(x)));
+			}
+
+			ft::pair<ft::AVLNODE<T>*, bool> insert_hint(ft::AVLNODE<T>* hint, T&& x)
 			{
-				return (contains(_node, k));
+				ft::AVLNODE<T>*	parent;
+				bool			left;
+				ft::AVLNODE<T>*	found = slot(hint, key_of(x), &parent, &left);
+
+				if (found != 0)
+					return (ft::make_pair(found, false));
+				return (ft::make_pair(link(parent, left, newNode(std::move(x))), true));
 			}
 
-			bool insert(T x)
+			// the key is only known once the value is built: a duplicate is built and freed again
+			template <class... Args>
+			ft::pair<ft::AVLNODE<T>*, bool> emplace_hint(ft::AVLNODE<T>* hint, Args&&... args)
 			{
-				if (!contains(_node, x.first))
+				ft::AVLNODE<T>*	node = newNode(std::forward<Args>(args)...);
+				ft::AVLNODE<T>*	parent;
+				bool			left;
+				ft::AVLNODE<T>*	found = slot(hint, key_of(node->_data), &parent, &left);
+
+				if (found != 0)
 				{
-					_node = insert(_node, x);
-					_node->parent = 0;
-					_size++;
-					return true;
+					delete_node(node);
+					return (ft::make_pair(found, false));
 				}
-				return false;
+				return (ft::make_pair(link(parent, left, node), true));
+			}
+
+			// nothing is built, not even the key, when k is already there
+			template <class K, class... Args>
+			ft::pair<ft::AVLNODE<T>*, bool> try_emplace(K&& k, Args&&... args)
+			{
+				ft::AVLNODE<T>*	parent;
+				bool			left;
+				ft::AVLNODE<T>*	found = descend(k, &parent, &left);
+
+				if (found != 0)
+					return (ft::make_pair(found, false));
+				// a named object: value(arg) with one argument would be a cast
+				value			v(std::forward<Args>(args)...);
+				ft::AVLNODE<T>*	node = newNode(std::forward<K>(k), std::move(v));
+				return (ft::make_pair(link(parent, left, node), true));
 			}
+#endif
 
-            bool remove(key x)
+            // how many were erased: 0 or 1, any number with Multi
+            size_t remove(const key& x)
             {
-                if (contains(_node, x))
+                ft::AVLNODE<T>* node = find(x);
+
+                if (node == 0)
+                    return (0);
+                if (!Multi)
                 {
-                    _node = remove(_node, x);
-                    _size--;
-                    return true;
+                    erase_node(node);
+                    return (1);
                 }
-                return false;
+
+                size_t          n = _size;
+                ft::AVLNODE<T>* last = upper_bound(x);
+
+                erase_range(node, (last) ? last : _header);
+                return (n - _size);
             }
 
-            ft::AVLNODE<T>* find(key x)
+            /*********************************************
+            * unlink node and free it. with two children its
+            * successor is moved into its place (relinked, not
+            * copied), so no other node or iterator changes.
+            * heights are fixed from the lowest touched node up
+            *********************************************/
+            void erase_node(ft::AVLNODE<T>* node)
             {
-                if (contains(_node, x))
-                    return (find(_node, x));
-                return 0;
+                ft::AVLNODE<T>* fix;
+
+                if (node == _header->left)
+                    _header->left = (node->right) ? findmin(node->right) : node->parent;
+                if (node == _header->right)
+                    _header->right = (node->left) ? findmax(node->left) : node->parent;
+                if (node->left != 0 && node->right != 0)
+                {
+                    ft::AVLNODE<T>* next = findmin(node->right);
+                    if (next->parent != node)
+                    {
+                        fix = next->parent;
+                        fix->left = next->right;
+                        if (next->right)
+                            next->right->parent = fix;
+                        next->right = node->right;
+                        node->right->parent = next;
+                    }
+                    else
+                        fix = next;
+                    next->left = node->left;
+                    node->left->parent = next;
+                    next->ht = node->ht;
+                    next->bf = node->bf;
+                    next->sz = node->sz;
+                    replace(node, next);
+                }
+                else
+                {
+                    fix = node->parent;
+                    replace(node, (node->left) ? node->left : node->right);
+                }
+                delete_node(node);
+                _size--;
+                if (_size == 0)
+                {
+                    _header->left = _header;
+                    _header->right = _header;
+                }
+                rebalance(fix);
             }
 
-            ft::AVLNODE<T>* find(key x) const
+            /*********************************************
+            * erase [first, last) (last may be the header).
+            * the tree is split around the range, the middle
+            * part is freed without rebalancing and the two
+            * sides are joined back: O(k + log n).
+            * the split goes by key, so with Multi a bound
+            * inside a run of equal keys is first moved to the
+            * start of the run, erasing node by node
+            *********************************************/
+            void erase_range(ft::AVLNODE<T>* first, ft::AVLNODE<T>* last)
             {
-                if (contains(_node, x))
-                    return (find(_node, x));
+                if (Multi)
+                {
+                    while (first != last && !starts_run(first))
+                    {
+                        ft::AVLNODE<T>* next = successor(first);
+                        erase_node(first);
+                        first = (next) ? next : _header;
+                    }
+                    while (first != last && last != _header && !starts_run(last))
+                    {
+                        ft::AVLNODE<T>* prev = predecessor(last);
+                        if (prev == first)
+                            first = last;
+                        erase_node(prev);
+                    }
+                }
+                if (first == last)
+                    return ;
+                if (first == _header->left && last == _header)
+                    return (delete_all());
+                if (successor(first) == ((last == _header) ? 0 : last))
+                    return (erase_node(first));
+
+                ft::AVLNODE<T>* before = (first == _header->left) ? 0 : predecessor(first);
+                ft::AVLNODE<T>* left;
+                ft::AVLNODE<T>* mid;
+                ft::AVLNODE<T>* right = 0;
+
+                split(_node, key_of(first->_data), &left, &mid);
+                if (last != _header)
+                {
+                    ft::AVLNODE<T>* rest = mid;
+                    split(rest, key_of(last->_data), &mid, &right);
+                }
+                _size -= static_cast<int>(free_subtree(mid));
+                if (right != 0)
+                {
+                    ft::AVLNODE<T>* pivot;
+                    right = remove_min(right, &pivot);
+                    _node = join(left, pivot, right);
+                }
+                else
+                    _node = left;
+                _node->parent = 0;
+                if (before == 0)
+                    _header->left = last;
+                if (last == _header)
+                    _header->right = before;
+            }
+
+            ft::AVLNODE<T>* find(const key& x) const
+            {
+                ft::AVLNODE<T>* node = lower_bound(x);
+
+                if (node != 0 && !_comp(x, key_of(node->_data)))
+                    return (node);
                 return 0;
             }
 
-            iterator bound(key k, int i)
+            iterator bound(const key& k, int i)
+            {
+                if (i == 1)
+                    return (to_iterator(upper_bound(k)));
+                return (to_iterator(lower_bound(k)));
+            }
+			 
+            const_iterator bound(const key& k, int i) const
             {
-                ft::AVLNODE<T>* con = 0;
                 if (i == 1)
+                    return (to_iterator(upper_bound(k)));
+                return (to_iterator(lower_bound(k)));
+            }
+
+            // first node not less than k / first node greater than k, 0 if none
+            ft::AVLNODE<T>* lower_bound(const key& k) const
+            {
+                ft::AVLNODE<T>* con = 0;
+                ft::AVLNODE<T>* x = _node;
+
+                while (x != 0)
                 {
-                    upper_bound(_node, k, &con);
-                    if (!con)
-                        return(iterator(0, this));
+                    if (!_comp(key_of(x->_data), k))
+                    {
+                        con = x;
+                        x = x->left;
+                    }
                     else
-                        return iterator(con, this);
+                        x = x->right;
                 }
-                else
+                return (con);
+            }
+
+            ft::AVLNODE<T>* upper_bound(const key& k) const
+            {
+                ft::AVLNODE<T>* con = 0;
+                ft::AVLNODE<T>* x = _node;
+
+                while (x != 0)
                 {
-                    lower_bound(_node, k, &con);
-                    if (!con)
-                        return (iterator(0, this));
+                    if (_comp(k, key_of(x->_data)))
+                    {
+                        con = x;
+                        x = x->left;
+                    }
                     else
-                        return iterator(con, this);
+                        x = x->right;
                 }
-                return iterator(0, this);
+                return (con);
             }
-			 
-            const_iterator bound(key k, int i) const
+          
+            /*********************************************
+            * O(1): nodes, header and pool change hands, so
+            * iterators stay valid and follow their elements
+            *********************************************/
+            void swap(AVL& x)
             {
+                std::swap(_node, x._node);
+                std::swap(_header, x._header);
+                _pool.swap(x._pool);
+                std::swap(b_alloc, x.b_alloc);
+                std::swap(_size, x._size);
+                std::swap(_comp, x._comp);
+            }
 
-                ft::AVLNODE<T>* con = 0;
+            /*********************************************
+            * order statistics, all O(log n) through the
+            * subtree sizes:
+            * select	k-th node in key order (from 0), 0 if none
+            * rank		how many keys are before k (upper: not after k)
+            * index		position of a node, size() for the header
+            *
+            * rotations and bulk builds always refresh sz, but
+            * an insert or erase only walks up as far as heights
+            * change. the first select/rank recounts the tree
+            * once and from then on the whole path is updated,
+            * so a map never asked for ranks never pays for it
+            *********************************************/
+            bool counting() const   {   return (_header != 0 && _header->bf != 0);  }
 
-                if (i == 1)
+            void start_counting() const
+            {
+                ft::AVLNODE<T>* x = _node;
+                ft::AVLNODE<T>* prev = 0;
+
+                if (counting() || _header == 0)
+                    return ;
+                // post-order through the parent links: a node is counted when left for its parent
+                while (x != 0)
                 {
-                    upper_bound(_node, k, &con);
-                    if (!con)
-                        return(const_iterator(0, this));
+                    if (prev == x->parent && x->left != 0)
+                        prev = x, x = x->left;
+                    else if ((prev == x->parent || prev == x->left) && x->right != 0)
+                        prev = x, x = x->right;
                     else
-                        return const_iterator(con, this);
+                    {
+                        x->sz = 1 + sz(x->left) + sz(x->right);
+                        prev = x;
+                        x = x->parent;
+                    }
                 }
-                else
+                _header->bf = 1;
+            }
+
+            ft::AVLNODE<T>* select(size_t k) const
+            {
+                ft::AVLNODE<T>* x = _node;
+
+                start_counting();
+                while (x != 0)
                 {
-                    lower_bound(_node, k, &con);
-                    if (!con)
-                        return(const_iterator(0, this));
-					else
-                        return const_iterator(con, this);
+                    size_t l = sz(x->left);
+                    if (k < l)
+                        x = x->left;
+                    else if (k == l)
+                        return (x);
+                    else
+                    {
+                        k -= l + 1;
+                        x = x->right;
+                    }
                 }
-                return const_iterator(0, this);
+                return (0);
             }
-          
-            node_alloc get_allocator() const    {   return (n_alloc);   }
+
+            size_t rank(const key& k, bool upper = false) const
+            {
+                ft::AVLNODE<T>* x = _node;
+                size_t          r = 0;
+
+                start_counting();
+                while (x != 0)
+                {
+                    if (upper ? !_comp(k, key_of(x->_data)) : _comp(key_of(x->_data), k))
+                    {
+                        r += sz(x->left) + 1;
+                        x = x->right;
+                    }
+                    else
+                        x = x->left;
+                }
+                return (r);
+            }
+
+            template <class Node>
+            static size_t index(Node* x)
+            {
+                if (x->ht < 0)
+                    return ((x->right == x) ? 0 : index(x->right) + 1);
+
+                size_t i = (x->left) ? x->left->sz : 0;
+                for (; x->parent != 0; x = x->parent)
+                    if (x == x->parent->right)
+                        i += ((x->parent->left) ? x->parent->left->sz : 0) + 1;
+                return (i);
+            }
+
+            node_alloc get_allocator() const    {   return (_pool.get_allocator());   }
 
             ft::AVLNODE<T>* getRoot(void) const {   return (_node);     }
+            ft::AVLNODE<T>* header(void) const  {   return (_header);   }
        
 
         private:
-            //  overwriting
-            //  recursively call sub trees 
-            bool contains(ft::AVLNODE<T>* node, key k) const
+            // 0, which is then also end(), in a tree without a header
+            ft::AVLNODE<T>* leftmost() const    {   return ((_header != 0) ? _header->left : 0);    }
+
+            // in-order neighbours through the parent links, 0 past either end
+            ft::AVLNODE<T>* successor(ft::AVLNODE<T>* node) const
+            {
+                if (node->right != 0)
+                    return (findmin(node->right));
+                while (node->parent != 0 && node == node->parent->right)
+                    node = node->parent;
+                return (node->parent);
+            }
+
+            ft::AVLNODE<T>* predecessor(ft::AVLNODE<T>* node) const
+            {
+                if (node->left != 0)
+                    return (findmax(node->left));
+                while (node->parent != 0 && node == node->parent->left)
+                    node = node->parent;
+                return (node->parent);
+            }
+
+            /*********************************************
+            * one comparison per level: remember the last node
+            * not greater than k, it is the only one that can
+            * be equal to it once the leaf is reached.
+            * returns that node, or 0 and where k would hang
+            * (with Multi always 0: after the equal keys)
+            *********************************************/
+            ft::AVLNODE<T>* descend(const key& k, ft::AVLNODE<T>** parent, bool* left) const
+            {
+                ft::AVLNODE<T>* prev = 0;
+                ft::AVLNODE<T>* x = _node;
+
+                *parent = 0;
+                *left = true;
+                while (x != 0)
                 {
-                if (node == 0)
-                    return false;
-                bool c1 = _comp(node->_data->first, k);
-                bool c2 = _comp(k, node->_data->first);
-                if (!c1 && !c2)
-                    return true;
-                if (!c1)
-                    return (contains(node->left, k));
-                if (c1)
-                    return (contains(node->right, k));
-                return true;
+                    *parent = x;
+                    *left = _comp(k, key_of(x->_data));
+                    if (*left)
+                        x = x->left;
+                    else
+                    {
+                        prev = x;
+                        x = x->right;
+                    }
+                }
+                if (!Multi && prev != 0 && !_comp(key_of(prev->_data), k))
+                    return (prev);
+                return (0);
             }
 
-        void update(ft::AVLNODE<T>* node)
-        {
-            int l_ht = (node->left == NULL) ? -1 : height(node->left);
-            int r_ht = (node->right == NULL) ? -1 : height(node->right);
-            node->ht = 1 + std::max(l_ht, r_ht);
-            node->bf = l_ht - r_ht;
-        }
+            // Multi: where k would hang before the equal keys
+            void descend_lower(const key& k, ft::AVLNODE<T>** parent, bool* left) const
+            {
+                *parent = 0;
+                *left = true;
+                for (ft::AVLNODE<T>* x = _node; x != 0; x = (*left) ? x->left : x->right)
+                {
+                    *parent = x;
+                    *left = !_comp(key_of(x->_data), k);
+                }
+            }
 
-        ft::AVLNODE<T>* insert(ft::AVLNODE<T>* node, T x){
-            if (!node)
-                return (newNode(x));
-            bool cmp = _comp(x.first, node->_data->first);
-            if (cmp)
+            /*********************************************
+            * same as descend, but first tries next to hint
+            * (the header meaning end(), 0 no hint): if k fits
+            * between the hint and its neighbour it is hung
+            * there and only the path above it is rebalanced.
+            * with Multi k fits right before the hint when it
+            * is neither less than its neighbour nor greater
+            * than the hint; otherwise it goes to the end of
+            * its equal keys nearest to the hint
+            *********************************************/
+            ft::AVLNODE<T>* slot(ft::AVLNODE<T>* hint, const key& k, ft::AVLNODE<T>** parent, bool* left) const
             {
-                node->left = insert(node->left, x);
-                node->left->parent = node;
+                if (_node == 0 || hint == 0)
+                    return (descend(k, parent, left));
+                if (Multi)
+                {
+                    ft::AVLNODE<T>* prev = (hint == _header) ? _header->right : predecessor(hint);
+                    if ((hint == _header || !_comp(key_of(hint->_data), k)) && (prev == 0 || !_comp(k, key_of(prev->_data))))
+                    {
+                        *left = (hint != _header && hint->left == 0);
+                        *parent = (*left) ? hint : prev;
+                        return (0);
+                    }
+                    // k goes after the hint: the closest place is before its equal keys
+                    if (hint != _header && _comp(key_of(hint->_data), k))
+                    {
+                        descend_lower(k, parent, left);
+                        return (0);
+                    }
+                }
+                else if (hint == _header)
+                {
+                    *parent = _header->right;
+                    *left = false;
+                    if (_comp(key_of((*parent)->_data), k))
+                        return (0);
+                }
+                else if (_comp(k, key_of(hint->_data)))
+                {
+                    ft::AVLNODE<T>* prev = predecessor(hint);
+                    if (prev == 0 || _comp(key_of(prev->_data), k))
+                    {
+                        *left = (hint->left == 0);
+                        *parent = (*left) ? hint : prev;
+                        return (0);
+                    }
+                }
+                else if (_comp(key_of(hint->_data), k))
+                {
+                    ft::AVLNODE<T>* next = successor(hint);
+                    if (next == 0 || _comp(k, key_of(next->_data)))
+                    {
+                        *left = (hint->right != 0);
+                        *parent = (*left) ? next : hint;
+                        return (0);
+                    }
+                }
+                else
+                    return (hint);
+                return (descend(k, parent, left));
             }
-            else if (!cmp)
+
+            // hang a new leaf under parent (0 for an empty tree), then fix heights upwards
+            ft::AVLNODE<T>* link(ft::AVLNODE<T>* parent, bool left, ft::AVLNODE<T>* node)
             {
-                node->right = insert(node->right,x);
-                node->right->parent = node;
+                node->parent = parent;
+                if (parent == 0)
+                {
+                    if (_header == 0)
+                    {
+                        try
+                        {
+                            _header = newHeader();
+                        }
+                        catch (...)
+                        {
+                            delete_node(node);
+                            throw;
+                        }
+                    }
+                    _node = node;
+                    _header->left = node;
+                    _header->right = node;
+                    _size++;
+                    return (node);
+                }
+                if (left)
+                    parent->left = node;
+                else
+                    parent->right = node;
+                if (left && parent == _header->left)
+                    _header->left = node;
+                else if (!left && parent == _header->right)
+                    _header->right = node;
+                _size++;
+                rebalance(parent);
+                return (node);
             }
-            update(node);
-            return (balance(node));
-        }
 
-        ft::AVLNODE<T>* find(ft::AVLNODE<T>* x, key val)
-        {
-            if (x == 0)
-                return 0;
-            bool cmp1 = _comp(x->_data->first, val);
-            bool cmp2 = _comp(val, x->_data->first);
-            if (!cmp1 && !cmp2)
-                return x;
-            if (cmp2)
-                return (find(x->left, val));
-            else if (cmp1)
-                return (find(x->right, val));
-            return x;
-        }
-            
-        ft::AVLNODE<T>* find(ft::AVLNODE<T>* node, key val) const
-        {
-            if (node == 0)
-                return 0;
-            bool cmp1 = _comp(node->_data->first, val);
-            bool cmp2 = _comp(val, node->_data->first);
-            if (!cmp1 && !cmp2)
-                return node;
-            if (!cmp1)
-                return (find(node->left, val));
-            else if (cmp1)
-                return (find(node->right, val));
-            return node;
-        }
+            /*********************************************
+            * walk up from node, refreshing ht/bf/sz and
+            * rotating where needed. balance only depends
+            * on subtree heights: once one is unchanged the
+            * rest of the path just recounts its sizes
+            *********************************************/
+            void rebalance(ft::AVLNODE<T>* node)
+            {
+                while (node != 0)
+                {
+                    ft::AVLNODE<T>* parent = node->parent;
+                    int             old_ht = node->ht;
+
+                    update(node);
+                    ft::AVLNODE<T>* sub = balance(node);
+                    sub->parent = parent;
+                    if (parent == 0)
+                        _node = sub;
+                    else if (parent->left == node)
+                        parent->left = sub;
+                    else
+                        parent->right = sub;
+                    node = parent;
+                    if (sub->ht == old_ht)
+                        break ;
+                }
+                if (counting())
+                    for (; node != 0; node = node->parent)
+                        node->sz = 1 + sz(node->left) + sz(node->right);
+            }
+
+            // nodes waiting for link_sorted are chained through right
+            void append(ft::AVLNODE<T>** list, ft::AVLNODE<T>** tail, ft::AVLNODE<T>* node)
+            {
+                if (*tail == 0)
+                    *list = node;
+                else
+                    (*tail)->right = node;
+                *tail = node;
+            }
+
+            void free_list(ft::AVLNODE<T>* list)
+            {
+                while (list != 0)
+                {
+                    ft::AVLNODE<T>* next = list->right;
+                    delete_node(list);
+                    list = next;
+                }
+            }
 
-        int height(ft::AVLNODE<T>* node)
+            // turn an in-order chain of n nodes into the whole (empty) tree
+            void link_sorted(ft::AVLNODE<T>* list, ft::AVLNODE<T>* tail, size_t n)
+            {
+                if (n == 0)
+                    return ;
+                if (_header == 0)
+                {
+                    try
+                    {
+                        _header = newHeader();
+                    }
+                    catch (...)
+                    {
+                        free_list(list);
+                        throw;
+                    }
+                }
+                _header->left = list;
+                _header->right = tail;
+                _node = build(&list, n);
+                _node->parent = 0;
+                _size = n;
+            }
+
+            /*********************************************
+            * left half, then the next node of the chain as
+            * the root, then the right half. the halves differ
+            * by at most one node so bf stays in [-1, 1];
+            * recursion depth is log n
+            *********************************************/
+            ft::AVLNODE<T>* build(ft::AVLNODE<T>** list, size_t n)
+            {
+                if (n == 0)
+                    return (0);
+                ft::AVLNODE<T>* left = build(list, n / 2);
+                ft::AVLNODE<T>* node = *list;
+
+                *list = node->right;
+                node->left = left;
+                if (left)
+                    left->parent = node;
+                node->right = build(list, n - n / 2 - 1);
+                if (node->right)
+                    node->right->parent = node;
+                update(node);
+                return (node);
+            }
+
+            static int ht(ft::AVLNODE<T>* node)    {   return ((node) ? node->ht : -1);  }
+            static const key& key_of(const T& x)   {   return (KeyOfValue()(x));         }
+
+            // no equal key right before node
+            bool starts_run(ft::AVLNODE<T>* node) const
+            {
+                ft::AVLNODE<T>* prev = predecessor(node);
+                return (prev == 0 || _comp(key_of(prev->_data), key_of(node->_data)));
+            }
+            static int sz(ft::AVLNODE<T>* node)    {   return ((node) ? node->sz : 0);   }
+
+            /*********************************************
+            * join two AVL trees around k, every key of l
+            * before k and every key of r after it. k goes
+            * down the spine of the taller tree to where the
+            * heights match, then the path is rebalanced:
+            * O(|ht(l) - ht(r)|)
+            *********************************************/
+            ft::AVLNODE<T>* join(ft::AVLNODE<T>* l, ft::AVLNODE<T>* k, ft::AVLNODE<T>* r)
+            {
+                if (ht(l) > ht(r) + 1)
+                {
+                    l->right = join(l->right, k, r);
+                    l->right->parent = l;
+                    update(l);
+                    return (balance(l));
+                }
+                if (ht(r) > ht(l) + 1)
+                {
+                    r->left = join(l, k, r->left);
+                    r->left->parent = r;
+                    update(r);
+                    return (balance(r));
+                }
+                k->left = l;
+                k->right = r;
+                if (l)
+                    l->parent = k;
+                if (r)
+                    r->parent = k;
+                update(k);
+                return (k);
+            }
+
+            // *l gets the keys before k, *r the others; parents of the two roots are left stale
+            void split(ft::AVLNODE<T>* t, const key& k, ft::AVLNODE<T>** l, ft::AVLNODE<T>** r)
+            {
+                ft::AVLNODE<T>* part;
+
+                if (t == 0)
+                {
+                    *l = 0;
+                    *r = 0;
+                    return ;
+                }
+                ft::AVLNODE<T>* tl = t->left;
+                ft::AVLNODE<T>* tr = t->right;
+                if (_comp(key_of(t->_data), k))
+                {
+                    split(tr, k, &part, r);
+                    *l = join(tl, t, part);
+                }
+                else
+                {
+                    split(tl, k, l, &part);
+                    *r = join(part, t, tr);
+                }
+            }
+
+            // detach the smallest node of the subtree t into *min
+            ft::AVLNODE<T>* remove_min(ft::AVLNODE<T>* t, ft::AVLNODE<T>** min)
+            {
+                if (t->left == 0)
+                {
+                    *min = t;
+                    return (t->right);
+                }
+                t->left = remove_min(t->left, min);
+                if (t->left)
+                    t->left->parent = t;
+                update(t);
+                return (balance(t));
+            }
+
+            // same walk as delete_tree, but the nodes go back to the pool one by one
+            size_t free_subtree(ft::AVLNODE<T>* x)
+            {
+                size_t n = 0;
+
+                if (x != 0)
+                    x->parent = 0;
+                while (x != 0)
+                {
+                    if (x->left != 0)
+                        x = x->left;
+                    else if (x->right != 0)
+                        x = x->right;
+                    else
+                    {
+                        ft::AVLNODE<T>* parent = x->parent;
+                        if (parent != 0 && parent->left == x)
+                            parent->left = 0;
+                        else if (parent != 0)
+                            parent->right = 0;
+                        delete_node(x);
+                        n++;
+                        x = parent;
+                    }
+                }
+                return (n);
+            }
+
+            // put child where node hangs, child may be 0
+            void replace(ft::AVLNODE<T>* node, ft::AVLNODE<T>* child)
+            {
+                if (child != 0)
+                    child->parent = node->parent;
+                if (node->parent == 0)
+                    _node = child;
+                else if (node->parent->left == node)
+                    node->parent->left = child;
+                else
+                    node->parent->right = child;
+            }
+
+        /*********************************************
+        * children already hold their own ht, so a node
+        * is refreshed in O(1) on the way back up
+        *********************************************/
+        void update(ft::AVLNODE<T>* node)
         {
-            if (node == 0)
-                return -1;
-            int leftHeight = height(node->left) + 1;
-            int rightHeight = height(node->right) + 1;
-            if (leftHeight > rightHeight)
-                return leftHeight;
-            return rightHeight;
+            int l_ht = (node->left == NULL) ? -1 : node->left->ht;
+            int r_ht = (node->right == NULL) ? -1 : node->right->ht;
+            node->ht = 1 + std::max(l_ht, r_ht);
+            node->bf = l_ht - r_ht;
+            node->sz = 1 + sz(node->left) + sz(node->right);
         }
 
 		/*********************************************
@@ -437,130 +1239,6 @@ namespace ft
                 oldRoot->right->parent = oldRoot;
         }
 
-		ft::AVLNODE<T>* freeNode(ft::AVLNODE<T>* node)
-		{
-			b_alloc.destroy(node->_data);
-			b_alloc.deallocate(node->_data, 1);
-            node->_data = NULL;
-			n_alloc.destroy(node);
-			n_alloc.deallocate(node, 1 * sizeof(ft::AVLNODE<T>*));
-			return node = NULL;
-		}
-
-        ft::AVLNODE<T>* remove(ft::AVLNODE<T>* node, key value)
-        {
-			if (!node) 
-				return node;
-			else if (_comp(value, node->_data->first))
-				node->left = remove(node->left, value);
-			else if (_comp(node->_data->first, value))
-				node->right = remove(node->right, value);
-			else 
-			{
-				if (!node->left && !node->right)
-					return node = freeNode(node);
-				else if (!node->left && node->right)
-				{
-					ft::AVLNODE<T>* new_node = node->right;
-					node = freeNode(node);
-					return new_node;
-				}
-				else if (node->left && !node->right)
-				{
-					T Svalue = findMax(node->left);
-                    b_alloc.destroy(node->_data);
-                    b_alloc.construct(node->_data, Svalue);
-                    node->left = remove(node->left, Svalue.first);
-				} 
-				else
-				{
-					T temp = findMin(node->right);
-					b_alloc.destroy(node->_data);
-					b_alloc.construct(node->_data, temp);
-					node->right = remove(node->right, temp.first);
-				}
-			}
-            update(node);
-            return (balance(node));
-        }
-
-        void lower_bound(ft::AVLNODE<T>* node, key val, ft::AVLNODE<T>** con) const
-        {
-            if (node == 0)
-                return ;
-            bool cmp = _comp(node->_data->first, val);
-            bool cmp1 = _comp(val, node->_data->first);
-            if (!cmp && !cmp1)
-            {
-                *con = node;
-                return ;
-            }
-            if (!cmp)
-                lower_bound(node->left, val, con);
-            if (*con == 0 && !cmp)
-            {
-                *con = node;
-                return ;
-            }
-            if (cmp)
-                lower_bound(node->right, val, con);
-        }
-
-        T findMin(ft::AVLNODE<T>* node) 
-        {
-            if (node == 0)
-                return (ft::make_pair(key(), value()));
-            while (node->left != 0)
-                node = node->left;
-            return (*(node->_data));
-        }
-        T findMax(ft::AVLNODE<T>* node) 
-        {
-            if (node == 0)
-                return (ft::make_pair(key(), value()));
-            while (node->right != 0)
-                node = node->right;
-            return (*(node->_data));
-        }
-        T findMin(ft::AVLNODE<T>* node) const
-        {
-            if (node == 0)
-                return (ft::make_pair(key(), value()));
-            while (node->left != 0)
-                node = node->left;
-            return (*(node->_data));
-        }
-        T findMax(ft::AVLNODE<T>* node) const
-        {
-            if (node == 0)
-                return (ft::make_pair(key(), value()));
-            while (node->right != 0)
-                node = node->right;
-            return (*(node->_data));
-        }
-
-        void upper_bound(ft::AVLNODE<T>* node, key val, ft::AVLNODE<T>** con) const
-        {
-            if (node == 0)
-                return ;
-            bool cmp =_comp(node->_data->first, val);
-            bool cmp1 = _comp(val, node->_data->first);
-            if (!cmp && !cmp1)
-            {
-                *con = node->right;
-                return ;
-            }
-            if (!cmp)
-                upper_bound(node->left, val, con);
-            if (*con == 0 && !cmp)
-            {
-                *con = node;
-                return ;
-            }
-            if (cmp)
-                upper_bound(node->right, val, con);
-        }
-
     };
 };
 
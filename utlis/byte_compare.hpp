@@ -0,0 +1,94 @@
+#ifndef BYTE_COMPARE_HPP
+#define BYTE_COMPARE_HPP
+
+#include <cstddef>
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+# include <immintrin.h>
+# define FT_BYTE_COMPARE_X86 1
+#endif
+
+namespace ft
+{
+	/*****************************************	first_mismatch	*****************************************
+	* Offset of the first byte where a and b differ, n if the n bytes are equal.
+	* On x86 it compares 16 bytes per step with SSE2, or 32 with AVX2 when the cpu has it (checked
+	  once, at the first call), so the build does not need -mavx2.
+	* Elsewhere it compares a word at a time.
+	*****************************************************************************************************/
+	inline std::size_t first_mismatch_bytes(const unsigned char* a, const unsigned char* b, std::size_t i, std::size_t n)
+	{
+		for (; i + sizeof(std::size_t) <= n; i += sizeof(std::size_t))
+		{
+			std::size_t x;
+			std::size_t y;
+
+			std::memcpy(&x, a + i, sizeof(x));
+			std::memcpy(&y, b + i, sizeof(y));
+			if (x != y)
+				break ;
+		}
+		for (; i < n; ++i)
+			if (a[i] != b[i])
+				return (i);
+		return (n);
+	}
+
+#ifdef FT_BYTE_COMPARE_X86
+	inline std::size_t first_mismatch_sse2(const unsigned char* a, const unsigned char* b, std::size_t i, std::size_t n)
+	{
+		for (; i + 16 <= n; i += 16)
+		{
+			__m128i		x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+			__m128i		y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+			unsigned	m = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+
+			if (m != 0xFFFFu)
+				return (i + __builtin_ctz(~m));
+		}
+		return (first_mismatch_bytes(a, b, i, n));
+	}
+
+	__attribute__((target("avx2")))
+	inline std::size_t first_mismatch_avx2(const unsigned char* a, const unsigned char* b, std::size_t n)
+	{
+		std::size_t i = 0;
+
+		for (; i + 32 <= n; i += 32)
+		{
+			__m256i		x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+			__m256i		y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+			unsigned	m = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+
+			if (m != 0xFFFFFFFFu)
+				return (i + __builtin_ctz(~m));
+		}
+		return (first_mismatch_sse2(a, b, i, n));
+	}
+
+	inline bool cpu_has_avx2()
+	{
+		__builtin_cpu_init();
+		return (__builtin_cpu_supports("avx2"));
+	}
+#endif
+
+	inline std::size_t first_mismatch(const void* a, const void* b, std::size_t n)
+	{
+		const unsigned char* x = static_cast<const unsigned char*>(a);
+		const unsigned char* y = static_cast<const unsigned char*>(b);
+
+#ifdef FT_BYTE_COMPARE_X86
+		static const bool avx2 = cpu_has_avx2();
+
+		if (avx2)
+			return (first_mismatch_avx2(x, y, n));
+		return (first_mismatch_sse2(x, y, 0, n));
+#else
+		return (first_mismatch_bytes(x, y, 0, n));
+#endif
+	}
+};
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef DEQUE_ITERATOR_HPP
+#define DEQUE_ITERATOR_HPP
+
+#include <cstddef>
+#include <iterator>
+#include "iterator_traits.hpp"
+#include "type_traits.hpp"
+
+namespace ft
+{
+	// elements per block of ft::deque: about a page, and never fewer than 16
+	template <class T>
+	struct deque_block
+	{
+		enum {	size = (sizeof(T) < 256) ? 4096 / sizeof(T) : 16	};
+	};
+
+	/*****************************************	deque_iterator	*****************************************
+	* A position in ft::deque: the element, the bounds of its block, and the block's entry in the map.
+	* Moving inside a block is pointer arithmetic; crossing into another block follows the map.
+	* A default constructed iterator (and the bounds of a deque that never allocated) is all null.
+	*****************************************************************************************************/
+	template <class T>
+	class deque_iterator : public ft::iterator<std::random_access_iterator_tag, T>
+	{
+		public:
+			typedef ft::iterator<std::random_access_iterator_tag, T>	traits_type;
+			typedef typename traits_type::difference_type				difference_type;
+			typedef typename traits_type::value_type					value_type;
+			typedef typename traits_type::pointer						pointer;
+			typedef typename traits_type::reference						reference;
+			typedef typename traits_type::iterator_category				iterator_category;
+			typedef typename ft::remove_const<T>::type*					block_pointer;
+			typedef block_pointer*										map_pointer;
+
+			// open to ft::deque, which moves its ends by hand
+			T*			_cur;
+			T*			_first;
+			T*			_last;
+			map_pointer	_node;
+
+			deque_iterator() : _cur(0), _first(0), _last(0), _node(0) {}
+			deque_iterator(T* cur, map_pointer node) : _cur(cur), _first(*node), _last(*node + block_size()), _node(node) {}
+			deque_iterator(const deque_iterator& x) : _cur(x._cur), _first(x._first), _last(x._last), _node(x._node) {}
+			template <class U>
+			deque_iterator(const deque_iterator<U>& x) : _cur(x._cur), _first(x._first), _last(x._last), _node(x._node) {}
+			~deque_iterator() {}
+
+			deque_iterator& operator=(const deque_iterator& x)
+			{
+				_cur = x._cur;
+				_first = x._first;
+				_last = x._last;
+				_node = x._node;
+				return (*this);
+			}
+
+			static difference_type block_size()	{	return (deque_block<T>::size);	}
+
+			T* base() const	{	return (_cur);	}
+
+			// onto the block of map entry node; _cur is left to the caller
+			void set_node(map_pointer node)
+			{
+				_node = node;
+				_first = *node;
+				_last = _first + block_size();
+			}
+
+			reference operator*() const		{	return (*_cur);	}
+			pointer operator->() const		{	return (_cur);	}
+
+			deque_iterator& operator++()
+			{
+				if (++_cur == _last)
+				{
+					set_node(_node + 1);
+					_cur = _first;
+				}
+				return (*this);
+			}
+
+			deque_iterator& operator--()
+			{
+				if (_cur == _first)
+				{
+					set_node(_node - 1);
+					_cur = _last;
+				}
+				--_cur;
+				return (*this);
+			}
+
+			deque_iterator operator++(int)	{	deque_iterator tmp(*this); ++*this; return (tmp);	}
+			deque_iterator operator--(int)	{	deque_iterator tmp(*this); --*this; return (tmp);	}
+
+			// n is counted from the start of the current block, then split into blocks and a rest
+			deque_iterator& operator+=(difference_type n)
+			{
+				difference_type offset = n + (_cur - _first);
+
+				if (offset >= 0 && offset < block_size())
+					_cur += n;
+				else
+				{
+					difference_type nodes = (offset > 0) ? offset / block_size() : -((-offset - 1) / block_size()) - 1;
+
+					set_node(_node + nodes);
+					_cur = _first + (offset - nodes * block_size());
+				}
+				return (*this);
+			}
+
+			deque_iterator& operator-=(difference_type n)			{	return (*this += -n);	}
+			deque_iterator operator+(difference_type n) const		{	deque_iterator tmp(*this); return (tmp += n);	}
+			deque_iterator operator-(difference_type n) const		{	deque_iterator tmp(*this); return (tmp -= n);	}
+			reference operator[](difference_type n) const			{	return (*(*this + n));	}
+	};
+
+	// NON MEMBER FUNCTIONS
+
+	template <class T1, class T2>
+	bool operator==(const deque_iterator<T1>& l, const deque_iterator<T2>& r)	{	return (l._cur == r._cur);	}
+
+	template <class T1, class T2>
+	bool operator!=(const deque_iterator<T1>& l, const deque_iterator<T2>& r)	{	return (l._cur != r._cur);	}
+
+	template <class T1, class T2>
+	bool operator<(const deque_iterator<T1>& l, const deque_iterator<T2>& r)
+	{
+		return ((l._node == r._node) ? (l._cur < r._cur) : (l._node < r._node));
+	}
+
+	template <class T1, class T2>
+	bool operator>(const deque_iterator<T1>& l, const deque_iterator<T2>& r)	{	return (r < l);		}
+
+	template <class T1, class T2>
+	bool operator<=(const deque_iterator<T1>& l, const deque_iterator<T2>& r)	{	return (!(r < l));	}
+
+	template <class T1, class T2>
+	bool operator>=(const deque_iterator<T1>& l, const deque_iterator<T2>& r)	{	return (!(l < r));	}
+
+	template <class T1, class T2>
+	typename deque_iterator<T1>::difference_type
+	operator-(const deque_iterator<T1>& l, const deque_iterator<T2>& r)
+	{
+		if (l._node == r._node)
+			return (l._cur - r._cur);
+		return (deque_iterator<T1>::block_size() * (l._node - r._node - 1) + (l._cur - l._first) + (r._last - r._cur));
+	}
+
+	template <class T>
+	deque_iterator<T>
+	operator+(typename deque_iterator<T>::difference_type n, const deque_iterator<T>& it)	{	return (it + n);	}
+};
+
+#endif
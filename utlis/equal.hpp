@@ -1,6 +1,12 @@
 #ifndef EQUAL_HPP
 #define EQUAL_HPP
 
+#include <cstring>
+#include <climits>
+#include "type_traits.hpp"
+#include "vec_iterator.hpp"
+#include "byte_compare.hpp"
+
 namespace ft
 {
 	/**************************************		std::equal	*****************************************
@@ -56,15 +62,84 @@ namespace ft
 	bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, Compare comp){
 		while (first1!=last1)
 		{
-			if ((first2==last2) || !comp(*first2,*first1))
+			if ((first2==last2) || comp(*first2,*first1))
 				return false;
-			else if (!comp(first1,*first2))
+			else if (comp(*first1,*first2))
 				return true;
 			++first1;
 			++first2;
 		}
 		return (first2!=last2);
 	};
+
+	/******************************		contiguous integral ranges	**********************************
+	* vec_iterators over the same integral type are plain arrays of bytes with no padding:
+	* equal								one memcmp
+	* lexicographical_compare		one memcmp for unsigned bytes; for wider or signed types the
+									first differing byte is found (SSE2/AVX2, see byte_compare.hpp)
+									and only the element holding it is compared with <
+	* anything else goes through the loops above, on the raw pointers
+	*******************************************************************************************************/
+	template <class T1, class T2>
+	struct is_bytewise_comparable
+	{
+		typedef typename ft::remove_const<T1>::type	type;
+
+		static const bool value = ft::is_integral<type>::value
+								&& ft::is_same<type, typename ft::remove_const<T2>::type>::value;
+		// memcmp order is the value order
+		static const bool unsigned_bytes = ft::is_same<type, unsigned char>::value || ft::is_same<type, bool>::value
+										|| (ft::is_same<type, char>::value && CHAR_MIN == 0);
+	};
+
+	template <class T1, class T2>
+	typename ft::enable_if<is_bytewise_comparable<T1, T2>::value, bool>::type
+	equal (ft::vec_iterator<T1> first1, ft::vec_iterator<T1> last1, ft::vec_iterator<T2> first2){
+		std::size_t n = last1 - first1;
+
+		return (n == 0 || std::memcmp(first1.base(), first2.base(), n * sizeof(T1)) == 0);
+	}
+
+	template <class T1, class T2>
+	typename ft::enable_if<!is_bytewise_comparable<T1, T2>::value, bool>::type
+	equal (ft::vec_iterator<T1> first1, ft::vec_iterator<T1> last1, ft::vec_iterator<T2> first2){
+		T1* p = first1.base();
+		T1* end = last1.base();
+		T2* q = first2.base();
+
+		for (; p != end; ++p, ++q)
+			if (!(*p == *q))
+				return false;
+		return true;
+	}
+
+	template <class T1, class T2>
+	typename ft::enable_if<is_bytewise_comparable<T1, T2>::value, bool>::type
+	lexicographical_compare (ft::vec_iterator<T1> first1, ft::vec_iterator<T1> last1, ft::vec_iterator<T2> first2, ft::vec_iterator<T2> last2){
+		std::size_t n1 = last1 - first1;
+		std::size_t n2 = last2 - first2;
+		std::size_t n = (n1 < n2) ? n1 : n2;
+
+		if (n != 0 && is_bytewise_comparable<T1, T2>::unsigned_bytes)
+		{
+			int r = std::memcmp(first1.base(), first2.base(), n);
+			if (r != 0)
+				return (r < 0);
+		}
+		else if (n != 0)
+		{
+			std::size_t i = ft::first_mismatch(first1.base(), first2.base(), n * sizeof(T1)) / sizeof(T1);
+			if (i < n)
+				return (first1.base()[i] < first2.base()[i]);
+		}
+		return (n1 < n2);
+	}
+
+	template <class T1, class T2>
+	typename ft::enable_if<!is_bytewise_comparable<T1, T2>::value, bool>::type
+	lexicographical_compare (ft::vec_iterator<T1> first1, ft::vec_iterator<T1> last1, ft::vec_iterator<T2> first2, ft::vec_iterator<T2> last2){
+		return (ft::lexicographical_compare(first1.base(), last1.base(), first2.base(), last2.base()));
+	}
 };
 
 #endif
\ No newline at end of file
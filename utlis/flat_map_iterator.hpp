@@ -0,0 +1,126 @@
+#ifndef FLAT_MAP_ITERATOR_HPP
+#define FLAT_MAP_ITERATOR_HPP
+
+#include <cstddef>
+#include <iterator>
+#include "iterator_traits.hpp"
+#include "type_traits.hpp"
+#include "pair.hpp"
+
+namespace ft
+{
+	/*****************************************	flat_map_iterator	*****************************************
+	* Walks ft::flat_map's two arrays side by side: one pointer into the keys, one into the mapped values.
+	* There is no pair in memory to point to, so operator* returns a flat_map_reference (first and
+	  second, both references) by value and operator-> a small object holding one: it->first and
+	  it->second work as with ft::map.
+	* T is const for the const_iterator; the key never is writable.
+	*********************************************************************************************************/
+	// what a flat_map_iterator points to: the key and the mapped value, both by reference
+	template <class Key, class T>
+	struct flat_map_reference
+	{
+		const Key&	first;
+		T&			second;
+
+		flat_map_reference(const Key& k, T& v) : first(k), second(v) {}
+
+		operator ft::pair<const Key, typename ft::remove_const<T>::type>() const	{	return (ft::pair<const Key, typename ft::remove_const<T>::type>(first, second));	}
+	};
+
+	template <class K, class T1, class T2>
+	bool operator==(const flat_map_reference<K, T1>& l, const flat_map_reference<K, T2>& r)	{	return (l.first == r.first && l.second == r.second);	}
+
+	template <class K, class T1, class T2>
+	bool operator!=(const flat_map_reference<K, T1>& l, const flat_map_reference<K, T2>& r)	{	return (!(l == r));	}
+
+	template <class K, class T1, class T2>
+	bool operator<(const flat_map_reference<K, T1>& l, const flat_map_reference<K, T2>& r)
+	{
+		return (l.first < r.first || (!(r.first < l.first) && l.second < r.second));
+	}
+
+	template <class Key, class T>
+	class flat_map_iterator
+	{
+		public:
+			typedef std::random_access_iterator_tag									iterator_category;
+			typedef ft::pair<const Key, typename ft::remove_const<T>::type>			value_type;
+			typedef std::ptrdiff_t													difference_type;
+			typedef ft::flat_map_reference<Key, T>									reference;
+
+			class pointer
+			{
+				reference	_ref;
+				public:
+					pointer(const reference& ref) : _ref(ref) {}
+					const reference* operator->() const	{	return (&_ref);	}
+			};
+
+		private:
+			const Key*	_key;
+			T*			_val;
+
+		public:
+			flat_map_iterator() : _key(0), _val(0) {}
+			flat_map_iterator(const Key* key, T* val) : _key(key), _val(val) {}
+			flat_map_iterator(const flat_map_iterator& x) : _key(x._key), _val(x._val) {}
+			template <class U>
+			flat_map_iterator(const flat_map_iterator<Key, U>& x) : _key(x.key_base()), _val(x.value_base()) {}
+			~flat_map_iterator() {}
+
+			flat_map_iterator& operator=(const flat_map_iterator& x)
+			{
+				_key = x._key;
+				_val = x._val;
+				return (*this);
+			}
+
+			const Key*	key_base() const	{	return (_key);	}
+			T*			value_base() const	{	return (_val);	}
+
+			reference operator*() const						{	return (reference(*_key, *_val));			}
+			pointer operator->() const						{	return (pointer(operator*()));				}
+			reference operator[](difference_type n) const	{	return (reference(_key[n], _val[n]));		}
+
+			flat_map_iterator& operator++()		{	++_key; ++_val;	return (*this);	}
+			flat_map_iterator& operator--()		{	--_key; --_val;	return (*this);	}
+			flat_map_iterator operator++(int)	{	flat_map_iterator tmp(*this); ++*this; return (tmp);	}
+			flat_map_iterator operator--(int)	{	flat_map_iterator tmp(*this); --*this; return (tmp);	}
+
+			flat_map_iterator& operator+=(difference_type n)		{	_key += n; _val += n; return (*this);		}
+			flat_map_iterator& operator-=(difference_type n)		{	_key -= n; _val -= n; return (*this);		}
+			flat_map_iterator operator+(difference_type n) const	{	return (flat_map_iterator(_key + n, _val + n));	}
+			flat_map_iterator operator-(difference_type n) const	{	return (flat_map_iterator(_key - n, _val - n));	}
+	};
+
+	// NON MEMBER FUNCTIONS: the key pointer alone tells the position
+
+	template <class K, class T1, class T2>
+	bool operator==(const flat_map_iterator<K, T1>& l, const flat_map_iterator<K, T2>& r)	{	return (l.key_base() == r.key_base());	}
+
+	template <class K, class T1, class T2>
+	bool operator!=(const flat_map_iterator<K, T1>& l, const flat_map_iterator<K, T2>& r)	{	return (l.key_base() != r.key_base());	}
+
+	template <class K, class T1, class T2>
+	bool operator<(const flat_map_iterator<K, T1>& l, const flat_map_iterator<K, T2>& r)		{	return (l.key_base() < r.key_base());	}
+
+	template <class K, class T1, class T2>
+	bool operator>(const flat_map_iterator<K, T1>& l, const flat_map_iterator<K, T2>& r)		{	return (l.key_base() > r.key_base());	}
+
+	template <class K, class T1, class T2>
+	bool operator<=(const flat_map_iterator<K, T1>& l, const flat_map_iterator<K, T2>& r)	{	return (l.key_base() <= r.key_base());	}
+
+	template <class K, class T1, class T2>
+	bool operator>=(const flat_map_iterator<K, T1>& l, const flat_map_iterator<K, T2>& r)	{	return (l.key_base() >= r.key_base());	}
+
+	template <class K, class T>
+	flat_map_iterator<K, T>
+	operator+(typename flat_map_iterator<K, T>::difference_type n, const flat_map_iterator<K, T>& it)	{	return (it + n);	}
+
+	template <class K, class T1, class T2>
+	typename flat_map_iterator<K, T1>::difference_type
+	operator-(const flat_map_iterator<K, T1>& l, const flat_map_iterator<K, T2>& r)	{	return (l.key_base() - r.key_base());	}
+};
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef GROWTH_POLICY_HPP
+#define GROWTH_POLICY_HPP
+
+#include <cstddef>
+
+namespace ft
+{
+	/*****************************************	GROWTH POLICIES	*****************************************
+	* The last template parameter of ft::vector. When the vector is full it asks
+	  	Growth::grow(capacity, required, sizeof(T))
+	  for the new capacity; the answer must be at least required. The vector clamps it to max_size().
+	* growth_double		2x
+	* growth_golden		1.5x, lets freed blocks be reused by later growth
+	* growth_size_class	1.5x rounded up to the allocator's size class, so no slack is wasted
+	* growth_paged<G>	G, then whole 4 KiB pages from 64 KiB on and whole 2 MiB huge pages from 4 MiB on
+	* All of them start at one cache line worth of elements instead of 1.
+	*****************************************************************************************************/
+
+	// first allocation: a 64 byte cache line, at least one element
+	inline std::size_t growth_min_capacity(std::size_t elem_size)
+	{
+		if (elem_size >= 64)
+			return (1);
+		return (64 / elem_size);
+	}
+
+	inline std::size_t growth_clamp(std::size_t want, std::size_t required, std::size_t elem_size)
+	{
+		std::size_t first = growth_min_capacity(elem_size);
+
+		if (want < required)
+			want = required;
+		if (want < first)
+			want = first;
+		return (want);
+	}
+
+	// capacity * num / den without overflowing
+	inline std::size_t growth_scale(std::size_t capacity, std::size_t num, std::size_t den)
+	{
+		if (capacity > static_cast<std::size_t>(-1) / num)
+			return (static_cast<std::size_t>(-1));
+		return (capacity * num / den);
+	}
+
+	// rounds bytes up to a multiple of unit (a power of two), in elements
+	inline std::size_t growth_round(std::size_t capacity, std::size_t elem_size, std::size_t unit)
+	{
+		std::size_t bytes = capacity * elem_size;
+
+		if (bytes / elem_size != capacity || bytes > static_cast<std::size_t>(-1) - unit)
+			return (capacity);
+		bytes = (bytes + unit - 1) & ~(unit - 1);
+		return (bytes / elem_size);
+	}
+
+	struct growth_double
+	{
+		static std::size_t grow(std::size_t capacity, std::size_t required, std::size_t elem_size)
+		{
+			return (growth_clamp(growth_scale(capacity, 2, 1), required, elem_size));
+		}
+	};
+
+	struct growth_golden
+	{
+		static std::size_t grow(std::size_t capacity, std::size_t required, std::size_t elem_size)
+		{
+			return (growth_clamp(growth_scale(capacity, 3, 2), required, elem_size));
+		}
+	};
+
+	/*********************************************
+	* jemalloc/tcmalloc style classes: 16 byte steps
+	* up to 128, then four classes per power of two
+	*********************************************/
+	struct growth_size_class
+	{
+		static std::size_t grow(std::size_t capacity, std::size_t required, std::size_t elem_size)
+		{
+			std::size_t n = growth_clamp(growth_scale(capacity, 3, 2), required, elem_size);
+			std::size_t bytes = n * elem_size;
+			std::size_t step = 16;
+
+			if (bytes / elem_size != n)
+				return (n);
+			if (bytes > 128)
+			{
+				std::size_t pow = 128;
+				while (pow * 2 < bytes && pow * 2 > pow)
+					pow *= 2;
+				step = pow / 4;
+			}
+			return (growth_round(n, elem_size, step));
+		}
+	};
+
+	template <class Growth = growth_double>
+	struct growth_paged
+	{
+		static const std::size_t page		= 4096;
+		static const std::size_t huge_page	= 2 * 1024 * 1024;
+
+		static std::size_t grow(std::size_t capacity, std::size_t required, std::size_t elem_size)
+		{
+			std::size_t n = Growth::grow(capacity, required, elem_size);
+
+			if (n >= 2 * huge_page / elem_size)
+				return (growth_round(n, elem_size, huge_page));
+			if (n >= 16 * page / elem_size)
+				return (growth_round(n, elem_size, page));
+			return (n);
+		}
+	};
+};
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef HASH_HPP
+#define HASH_HPP
+
+#include <cstddef>
+#include <string>
+#if __cplusplus >= 201103L
+# include <functional>
+#endif
+
+// C++11: these hashes can't throw, which lets a rehash move the elements (see hash_table::rebuild)
+#if __cplusplus >= 201103L
+# define FT_HASH_NOEXCEPT	noexcept
+#else
+# define FT_HASH_NOEXCEPT
+#endif
+
+namespace ft
+{
+	/*****************************************	hash	*****************************************
+	* The hash the unordered containers use by default.
+	* Integers and pointers hash to themselves and std::string with FNV-1a: the table mixes every
+	  hash before use (see hash_table.hpp), so the function only has to tell keys apart.
+	* C++11: any other key goes to std::hash; in C++98 there is no default for it.
+	**********************************************************************************************/
+#if __cplusplus >= 201103L
+	template <class T>
+	struct hash : std::hash<T> {};
+#else
+	template <class T>
+	struct hash;
+#endif
+
+	template <class T>
+	struct hash_integral
+	{
+		std::size_t operator()(T x) const FT_HASH_NOEXCEPT	{	return (static_cast<std::size_t>(x));	}
+	};
+
+	template <>	struct hash<bool>				: hash_integral<bool>				{};
+	template <>	struct hash<char>				: hash_integral<char>				{};
+	template <>	struct hash<wchar_t>			: hash_integral<wchar_t>			{};
+	template <>	struct hash<signed char>		: hash_integral<signed char>		{};
+	template <>	struct hash<unsigned char>		: hash_integral<unsigned char>		{};
+	template <>	struct hash<short>				: hash_integral<short>				{};
+	template <>	struct hash<unsigned short>		: hash_integral<unsigned short>		{};
+	template <>	struct hash<int>				: hash_integral<int>				{};
+	template <>	struct hash<unsigned int>		: hash_integral<unsigned int>		{};
+	template <>	struct hash<long>				: hash_integral<long>				{};
+	template <>	struct hash<unsigned long>		: hash_integral<unsigned long>		{};
+	template <>	struct hash<long long>			: hash_integral<long long>			{};
+	template <>	struct hash<unsigned long long>	: hash_integral<unsigned long long>	{};
+
+	template <class T>
+	struct hash<T*>
+	{
+		std::size_t operator()(T* p) const FT_HASH_NOEXCEPT	{	return (reinterpret_cast<std::size_t>(p));	}
+	};
+
+	template <>
+	struct hash<std::string>
+	{
+		std::size_t operator()(const std::string& s) const FT_HASH_NOEXCEPT
+		{
+			unsigned long long h = 14695981039346656037ULL;
+
+			for (std::size_t i = 0; i < s.size(); i++)
+			{
+				h ^= static_cast<unsigned char>(s[i]);
+				h *= 1099511628211ULL;
+			}
+			return (static_cast<std::size_t>(h));
+		}
+	};
+};
+
+#endif
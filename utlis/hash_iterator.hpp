@@ -0,0 +1,93 @@
+#ifndef HASH_ITERATOR_HPP
+#define HASH_ITERATOR_HPP
+
+#include <cstddef>
+#include <iterator>
+#include "iterator_traits.hpp"
+
+namespace ft
+{
+	/*********************************************
+	* one control byte per slot of a hash_table:
+	* full		0..127, 7 bits of the hash
+	* empty		never used since the last rehash
+	* deleted	erased, probing goes on past it
+	* end		one past the last slot, stops iteration
+	* a byte below end is a slot with no element
+	*********************************************/
+	struct hash_ctrl
+	{
+		enum
+		{
+			empty	= -128,
+			deleted	= -2,
+			end		= -1
+		};
+	};
+
+	/*********************************************
+	* walks the slots in table order, reading the
+	* control bytes to skip the unused ones
+	*********************************************/
+	template <class T>
+	class hash_iterator : public ft::iterator<std::forward_iterator_tag, T>
+	{
+		public:
+			typedef ft::iterator<std::forward_iterator_tag, T>		traits_type;
+			typedef typename traits_type::difference_type			difference_type;
+			typedef typename traits_type::value_type				value_type;
+			typedef typename traits_type::pointer					pointer;
+			typedef typename traits_type::reference					reference;
+			typedef typename traits_type::iterator_category			iterator_category;
+
+		private:
+			const signed char*	_ctrl;
+			T*					_slot;
+
+		public:
+			hash_iterator() : _ctrl(0), _slot(0) {}
+			hash_iterator(const signed char* ctrl, T* slot) : _ctrl(ctrl), _slot(slot) {}
+			hash_iterator(const hash_iterator& x) : _ctrl(x._ctrl), _slot(x._slot) {}
+			template <class U>
+			hash_iterator(const hash_iterator<U>& x) : _ctrl(x.ctrl_base()), _slot(x.base()) {}
+			~hash_iterator() {}
+
+			hash_iterator& operator=(const hash_iterator& x)
+			{
+				_ctrl = x._ctrl;
+				_slot = x._slot;
+				return (*this);
+			}
+
+			const signed char*	ctrl_base() const	{	return (_ctrl);	}
+			T*					base() const		{	return (_slot);	}
+
+			reference operator*() const		{	return (*_slot);	}
+			pointer operator->() const		{	return (_slot);		}
+
+			hash_iterator& operator++()
+			{
+				do
+				{
+					++_ctrl;
+					++_slot;
+				} while (*_ctrl < hash_ctrl::end);
+				return (*this);
+			}
+
+			hash_iterator operator++(int)
+			{
+				hash_iterator tmp(*this);
+				++*this;
+				return (tmp);
+			}
+	};
+
+	template <class T1, class T2>
+	bool operator==(const hash_iterator<T1>& l, const hash_iterator<T2>& r)	{	return (l.ctrl_base() == r.ctrl_base());	}
+
+	template <class T1, class T2>
+	bool operator!=(const hash_iterator<T1>& l, const hash_iterator<T2>& r)	{	return (l.ctrl_base() != r.ctrl_base());	}
+};
+
+#endif
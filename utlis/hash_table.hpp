@@ -0,0 +1,632 @@
+#ifndef HASH_TABLE_HPP
+#define HASH_TABLE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <utility>
+#if __cplusplus >= 201103L
+# include <type_traits>
+#endif
+#include "pair.hpp"
+#include "type_traits.hpp"
+#include "relocate.hpp"
+#include "key_extract.hpp"
+#include "hash_iterator.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+# include <emmintrin.h>
+# define FT_HASH_TABLE_SSE2 1
+#endif
+
+namespace ft
+{
+	/*********************************************
+	* 16 control bytes looked at together, each
+	* query a bit mask with bit i for byte i.
+	* SSE2: one load, compare and movemask;
+	* elsewhere a loop over the bytes
+	*********************************************/
+	struct ctrl_group
+	{
+		enum {	size = 16	};
+
+#ifdef FT_HASH_TABLE_SSE2
+		__m128i	bytes;
+
+		explicit ctrl_group(const signed char* p) : bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) {}
+
+		unsigned match(signed char c) const		{	return (static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(c), bytes))));		}
+		// empty or deleted: the only bytes below end
+		unsigned match_free() const				{	return (static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(hash_ctrl::end), bytes))));	}
+#else
+		const signed char*	bytes;
+
+		explicit ctrl_group(const signed char* p) : bytes(p) {}
+
+		unsigned match(signed char c) const
+		{
+			unsigned m = 0;
+			for (int i = 0; i < size; i++)
+				m |= static_cast<unsigned>(bytes[i] == c) << i;
+			return (m);
+		}
+
+		unsigned match_free() const
+		{
+			unsigned m = 0;
+			for (int i = 0; i < size; i++)
+				m |= static_cast<unsigned>(bytes[i] < hash_ctrl::end) << i;
+			return (m);
+		}
+#endif
+		unsigned match_empty() const			{	return (match(hash_ctrl::empty));	}
+
+		static std::size_t lowest(unsigned m)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return (__builtin_ctz(m));
+#else
+			std::size_t i = 0;
+			while (!(m & 1u))
+			{
+				m >>= 1;
+				i++;
+			}
+			return (i);
+#endif
+		}
+	};
+
+	/*****************************************	hash_table	*****************************************
+	* Open addressing table behind ft::unordered_map and ft::unordered_set, keyed like ft::AVL through
+	  KeyOfValue (see key_extract.hpp).
+	* Elements sit in one array of slots, with a parallel array of control bytes (see hash_iterator.hpp)
+	  holding 7 bits of each element's hash. The other bits pick a group of 16 slots; a lookup compares
+	  the whole group's control bytes to those 7 bits at once and only calls KeyEqual on the matches.
+	  Groups are probed quadratically until one has an empty byte.
+	* Erasing leaves the slot empty when its group still has an empty byte: no probe can have gone past
+	  that group, so nothing needs the slot as a marker. Otherwise it becomes deleted (a tombstone).
+	* Growth is by powers of 2, once empty slots would pass max_load_factor of the table. Tombstones
+	  count as used; when they are most of it the table is rebuilt at the same size instead.
+	* Any rehash invalidates iterators; erasing invalidates only the erased one.
+	*****************************************************************************************************/
+	template <class Key, class T, class KeyOfValue, class Hash, class KeyEqual, class Allocator = std::allocator<T> >
+	class hash_table
+	{
+		public:
+			typedef T																value_type;
+			typedef Key																key;
+			typedef typename KeyOfValue::mapped_type								value;
+			typedef typename Allocator::template rebind<signed char>::other		ctrl_allocator;
+			typedef ft::hash_iterator<T>											iterator;
+			typedef ft::hash_iterator<const T>										const_iterator;
+
+		private:
+			signed char*	_ctrl;			// _capacity bytes then end; a lone end byte while empty
+			T*				_slots;
+			std::size_t		_capacity;		// 0 or a power of 2, at least one group
+			std::size_t		_size;
+			std::size_t		_growth_left;	// empty slots that may still be taken before a rehash
+			float			_max_load;
+			Hash			_hash;
+			KeyEqual		_eq;
+			Allocator		_alloc;
+			ctrl_allocator	_ctrl_alloc;
+
+		public:
+			explicit hash_table(std::size_t n = 0, const Hash& hash = Hash(), const KeyEqual& eq = KeyEqual(), const Allocator& alloc = Allocator())
+				: _ctrl(no_slots()), _slots(0), _capacity(0), _size(0), _growth_left(0), _max_load(0.875f),
+				  _hash(hash), _eq(eq), _alloc(alloc), _ctrl_alloc(alloc)
+			{
+				if (n != 0)
+					rehash(n);
+			}
+
+			// same capacity, same slots: no element is hashed again
+			hash_table(const hash_table& x)
+				: _ctrl(no_slots()), _slots(0), _capacity(0), _size(0), _growth_left(0), _max_load(x._max_load),
+				  _hash(x._hash), _eq(x._eq), _alloc(x._alloc), _ctrl_alloc(x._ctrl_alloc)
+			{
+				if (x._size == 0)
+					return ;
+
+				signed char*	ctrl = _ctrl_alloc.allocate(x._capacity + 1);
+				T*				slots = 0;
+				std::size_t		i = 0;
+
+				try
+				{
+					slots = _alloc.allocate(x._capacity);
+					std::memcpy(ctrl, x._ctrl, x._capacity + 1);
+					for (; i < x._capacity; i++)
+						if (ctrl[i] >= 0)
+							_alloc.construct(slots + i, x._slots[i]);
+				}
+				catch (...)
+				{
+					free_slots(ctrl, slots, i, x._capacity);
+					throw;
+				}
+				_ctrl = ctrl;
+				_slots = slots;
+				_capacity = x._capacity;
+				_size = x._size;
+				_growth_left = x._growth_left;
+			}
+
+			hash_table& operator=(const hash_table& x)
+			{
+				if (this != &x)
+				{
+					hash_table tmp(x);
+					swap(tmp);
+				}
+				return (*this);
+			}
+
+#if __cplusplus >= 201103L
+			hash_table(hash_table&& x) noexcept
+				: _ctrl(no_slots()), _slots(0), _capacity(0), _size(0), _growth_left(0), _max_load(x._max_load),
+				  _hash(x._hash), _eq(x._eq), _alloc(x._alloc), _ctrl_alloc(x._ctrl_alloc)
+			{
+				swap(x);
+			}
+
+			hash_table& operator=(hash_table&& x) noexcept
+			{
+				if (this != &x)
+				{
+					hash_table tmp(std::move(x));
+					swap(tmp);
+				}
+				return (*this);
+			}
+#endif
+
+			~hash_table()
+			{
+				clear();
+				if (_capacity != 0)
+				{
+					_ctrl_alloc.deallocate(_ctrl, _capacity + 1);
+					_alloc.deallocate(_slots, _capacity);
+				}
+			}
+
+			/*****************	ITERATORS	******************/
+			iterator begin()				{	std::size_t i = first_full();	return (iterator(_ctrl + i, _slots + i));			}
+			const_iterator begin() const	{	std::size_t i = first_full();	return (const_iterator(_ctrl + i, _slots + i));	}
+			iterator end()					{	return (iterator(_ctrl + _capacity, _slots + _capacity));			}
+			const_iterator end() const		{	return (const_iterator(_ctrl + _capacity, _slots + _capacity));		}
+
+			iterator to_iterator(std::size_t i)				{	return ((i == npos()) ? end() : iterator(_ctrl + i, _slots + i));			}
+			const_iterator to_iterator(std::size_t i) const	{	return ((i == npos()) ? end() : const_iterator(_ctrl + i, _slots + i));	}
+			std::size_t index(const_iterator it) const			{	return (it.ctrl_base() - _ctrl);	}
+
+			/*****************	CAPACITY	******************/
+			bool empty() const				{	return (_size == 0);	}
+			std::size_t size() const		{	return (_size);			}
+			std::size_t capacity() const	{	return (_capacity);		}
+			std::size_t max_size() const	{	return (_alloc.max_size());	}
+
+			/*****************	LOOKUP	******************
+			* find		slot of k, npos() if absent
+			**********************************************/
+			static std::size_t npos()	{	return (static_cast<std::size_t>(-1));	}
+
+			std::size_t find(const key& k) const
+			{
+				return (find(k, hash_of(k)));
+			}
+
+			bool contains(const key& k) const
+			{
+				return (find(k) != npos());
+			}
+
+			/*****************	INSERT	******************
+			* all return the slot holding the key and
+			  whether it had to be created
+			* insert_value		x itself
+			* find_or_insert	(k, value()) if k is new
+			* insert_unique		(k, *v) if k is new (map only)
+			**********************************************/
+			ft::pair<std::size_t, bool> insert_value(const T& x)
+			{
+				const key&	k = key_of(x);
+				std::size_t	h = hash_of(k);
+				std::size_t	i = find(k, h);
+
+				if (i != npos())
+					return (ft::make_pair(i, false));
+				i = prepare_insert(h);
+				_alloc.construct(_slots + i, x);
+				return (ft::make_pair(commit(i, h), true));
+			}
+
+			ft::pair<std::size_t, bool> find_or_insert(const key& k)
+			{
+				return (insert_unique(k, 0));
+			}
+
+			// *v may be an element of this table: it is copied before a rehash can free it
+			ft::pair<std::size_t, bool> insert_unique(const key& k, const value* v)
+			{
+				std::size_t	h = hash_of(k);
+				std::size_t	i = find(k, h);
+
+				if (i != npos())
+					return (ft::make_pair(i, false));
+
+				T	x = v ? T(k, *v) : T(k, value());
+
+				i = prepare_insert(h);
+				_alloc.construct(_slots + i, x);
+				return (ft::make_pair(commit(i, h), true));
+			}
+
+#if __cplusplus >= 201103L
+			ft::pair<std::size_t, bool> insert_value(T&& x)
+			{
+				std::size_t	h = hash_of(key_of(x));
+				std::size_t	i = find(key_of(x), h);
+
+				if (i != npos())
+					return (ft::make_pair(i, false));
+				i = prepare_insert(h);
+				_alloc.construct(_slots + i, std::move(x));
+				return (ft::make_pair(commit(i, h), true));
+			}
+
+			// the key is only known once the value is built: it is built aside, then moved in.
+			// x and v below are named objects: T(arg) with one argument would be a cast
+			template <class... Args>
+			ft::pair<std::size_t, bool> emplace(Args&&... args)
+			{
+				T	x(std::forward<Args>(args)...);
+
+				return (insert_value(std::move(x)));
+			}
+
+			// nothing is built when k is already there; otherwise the value is built before
+			// the rehash, as args may refer to elements of this table
+			template <class K, class... Args>
+			ft::pair<std::size_t, bool> try_emplace(K&& k, Args&&... args)
+			{
+				std::size_t	h = hash_of(k);
+				std::size_t	i = find(k, h);
+
+				if (i != npos())
+					return (ft::make_pair(i, false));
+
+				value	v(std::forward<Args>(args)...);
+				T		x(std::forward<K>(k), std::move(v));
+
+				i = prepare_insert(h);
+				_alloc.construct(_slots + i, std::move(x));
+				return (ft::make_pair(commit(i, h), true));
+			}
+#endif
+
+			/*****************	ERASE	******************/
+			void erase_slot(std::size_t i)
+			{
+				_alloc.destroy(_slots + i);
+				--_size;
+				if (ctrl_group(_ctrl + (i & ~static_cast<std::size_t>(ctrl_group::size - 1))).match_empty())
+				{
+					_ctrl[i] = hash_ctrl::empty;
+					++_growth_left;
+				}
+				else
+					_ctrl[i] = hash_ctrl::deleted;
+			}
+
+			std::size_t remove(const key& k)
+			{
+				std::size_t i = find(k);
+
+				if (i == npos())
+					return (0);
+				erase_slot(i);
+				return (1);
+			}
+
+			// keeps the slots, as after a rehash
+			void clear()
+			{
+				if (_capacity == 0)
+					return ;
+				if (!ft::is_trivially_destructible<T>::value)
+					for (std::size_t i = 0; i < _capacity; i++)
+						if (_ctrl[i] >= 0)
+							_alloc.destroy(_slots + i);
+				std::memset(_ctrl, hash_ctrl::empty, _capacity);
+				_size = 0;
+				_growth_left = limit(_capacity, _max_load);
+			}
+
+			void swap(hash_table& x)
+			{
+				std::swap(_ctrl, x._ctrl);
+				std::swap(_slots, x._slots);
+				std::swap(_capacity, x._capacity);
+				std::swap(_size, x._size);
+				std::swap(_growth_left, x._growth_left);
+				std::swap(_max_load, x._max_load);
+				std::swap(_hash, x._hash);
+				std::swap(_eq, x._eq);
+				std::swap(_alloc, x._alloc);
+				std::swap(_ctrl_alloc, x._ctrl_alloc);
+			}
+
+			/*****************	HASH POLICY	******************
+			* rehash			at least n slots, and enough for size();
+			  					rebuilds even at the same size, dropping tombstones
+			* reserve			room for n elements without a rehash
+			* max_load_factor	kept within [1/16, 15/16]: probing needs an empty slot
+			**************************************************/
+			void rehash(std::size_t n)
+			{
+				std::size_t cap = capacity_for(_size, _max_load);
+
+				while (cap < n)
+					cap *= 2;
+				if (_size == 0 && n == 0)
+					return (release());
+				rebuild(cap);
+			}
+
+			void reserve(std::size_t n)
+			{
+				if (n > _size + _growth_left)
+					rebuild(capacity_for(n, _max_load));
+			}
+
+			float load_factor() const		{	return ((_capacity) ? static_cast<float>(_size) / _capacity : 0.0f);	}
+			float max_load_factor() const	{	return (_max_load);	}
+
+			void max_load_factor(float ml)
+			{
+				if (!(ml >= 0.0625f))
+					ml = 0.0625f;
+				if (ml > 0.9375f)
+					ml = 0.9375f;
+				_max_load = ml;
+				if (_capacity != 0)
+					rehash(0);
+			}
+
+			Hash hash_function() const			{	return (_hash);			}
+			KeyEqual key_eq() const				{	return (_eq);			}
+			Allocator get_allocator() const		{	return (_alloc);		}
+
+			static const key& key_of(const T& x)	{	return (KeyOfValue()(x));	}
+
+		private:
+			// the lone end byte of a table without slots: begin() == end() and nothing to free
+			static signed char* no_slots()
+			{
+				static signed char ctrl = hash_ctrl::end;
+				return (&ctrl);
+			}
+
+			/*********************************************
+			* multiply and fold: identity hashes (ints,
+			* pointers) get entropy in every bit, the low 7
+			* for the control byte, the rest for the group
+			*********************************************/
+			std::size_t hash_of(const key& k) const
+			{
+				unsigned long long h = static_cast<unsigned long long>(_hash(k)) * 0x9E3779B97F4A7C15ULL;
+
+				return (static_cast<std::size_t>(h ^ (h >> 32)));
+			}
+
+#if __cplusplus >= 201103L
+			/*********************************************
+			* what rebuild() builds the new element from.
+			* with a hash that may throw halfway, an element
+			* already moved would be lost with the new slots:
+			* it is copied (unless T can only be moved)
+			*********************************************/
+			typedef std::integral_constant<bool, noexcept(std::declval<const Hash&>()(std::declval<const key&>()))>	nothrow_hash;
+
+			static decltype(std::move_if_noexcept(std::declval<T&>())) relocated(T& x, std::true_type)
+			{
+				return (std::move_if_noexcept(x));
+			}
+
+			typedef typename std::conditional<std::is_copy_constructible<T>::value, const T&, T&&>::type					copy_source;
+
+			static copy_source relocated(T& x, std::false_type)
+			{
+				return (static_cast<copy_source>(x));
+			}
+#endif
+
+			static signed char h2(std::size_t h)	{	return (static_cast<signed char>(h & 0x7F));	}
+
+			std::size_t find(const key& k, std::size_t h) const
+			{
+				if (_size == 0)
+					return (npos());
+
+				std::size_t	mask = _capacity / ctrl_group::size - 1;
+				std::size_t	g = (h >> 7) & mask;
+
+				for (std::size_t step = 1; ; step++)
+				{
+					ctrl_group	grp(_ctrl + g * ctrl_group::size);
+
+					for (unsigned m = grp.match(h2(h)); m != 0; m &= m - 1)
+					{
+						std::size_t i = g * ctrl_group::size + ctrl_group::lowest(m);
+						if (_eq(key_of(_slots[i]), k))
+							return (i);
+					}
+					if (grp.match_empty())
+						return (npos());
+					g = (g + step) & mask;
+				}
+			}
+
+			// first empty or deleted slot on the probe sequence of h
+			static std::size_t find_free(const signed char* ctrl, std::size_t capacity, std::size_t h)
+			{
+				std::size_t	mask = capacity / ctrl_group::size - 1;
+				std::size_t	g = (h >> 7) & mask;
+
+				for (std::size_t step = 1; ; step++)
+				{
+					unsigned m = ctrl_group(ctrl + g * ctrl_group::size).match_free();
+					if (m != 0)
+						return (g * ctrl_group::size + ctrl_group::lowest(m));
+					g = (g + step) & mask;
+				}
+			}
+
+			// a slot for a new element of hash h, growing first if taking it would pass the load limit
+			std::size_t prepare_insert(std::size_t h)
+			{
+				if (_capacity != 0)
+				{
+					std::size_t i = find_free(_ctrl, _capacity, h);
+					if (_growth_left != 0 || _ctrl[i] == hash_ctrl::deleted)
+						return (i);
+				}
+				if (_capacity != 0 && _size < limit(_capacity, _max_load) / 2)
+					rebuild(_capacity);
+				else
+					rebuild((_capacity) ? _capacity * 2 : capacity_for(1, _max_load));
+				return (find_free(_ctrl, _capacity, h));
+			}
+
+			// the element is built in slot i
+			std::size_t commit(std::size_t i, std::size_t h)
+			{
+				if (_ctrl[i] == hash_ctrl::empty)
+					--_growth_left;
+				_ctrl[i] = h2(h);
+				++_size;
+				return (i);
+			}
+
+			// elements a table of cap slots holds before growing, leaving at least one slot empty
+			static std::size_t limit(std::size_t cap, float ml)
+			{
+				std::size_t n = static_cast<std::size_t>(cap * ml);
+
+				if (n >= cap)
+					n = cap - 1;
+				return ((n) ? n : 1);
+			}
+
+			static std::size_t capacity_for(std::size_t n, float ml)
+			{
+				std::size_t cap = ctrl_group::size;
+
+				while (limit(cap, ml) < n)
+					cap *= 2;
+				return (cap);
+			}
+
+			std::size_t first_full() const
+			{
+				std::size_t i = 0;
+
+				while (_ctrl[i] < hash_ctrl::end)
+					i++;
+				return (i);
+			}
+
+			/*********************************************
+			* every element goes to its slot in new arrays
+			* of cap slots. trivially relocatable ones are
+			* copied as bytes, others are copied and only
+			* then destroyed, so a throw leaves the table as
+			* it was. C++11 moves instead when neither the
+			* move nor the hash can throw (see relocated)
+			*********************************************/
+			void rebuild(std::size_t cap)
+			{
+				signed char*	ctrl = _ctrl_alloc.allocate(cap + 1);
+				T*				slots = 0;
+
+				std::memset(ctrl, hash_ctrl::empty, cap);
+				ctrl[cap] = hash_ctrl::end;
+				try
+				{
+					slots = _alloc.allocate(cap);
+					for (std::size_t i = 0; i < _capacity; i++)
+					{
+						if (_ctrl[i] < 0)
+							continue ;
+
+						std::size_t h = hash_of(key_of(_slots[i]));
+						std::size_t j = find_free(ctrl, cap, h);
+
+						if (ft::is_trivially_relocatable<T>::value)
+							std::memcpy(static_cast<void*>(slots + j), static_cast<const void*>(_slots + i), sizeof(T));
+						else
+#if __cplusplus >= 201103L
+							_alloc.construct(slots + j, relocated(_slots[i], nothrow_hash()));
+#else
+							_alloc.construct(slots + j, _slots[i]);
+#endif
+						ctrl[j] = h2(h);
+					}
+				}
+				catch (...)
+				{
+					if (ft::is_trivially_relocatable<T>::value)
+						std::memset(ctrl, hash_ctrl::empty, cap);
+					free_slots(ctrl, slots, cap, cap);
+					throw;
+				}
+				if (_capacity != 0)
+				{
+					if (!ft::is_trivially_relocatable<T>::value)
+						for (std::size_t i = 0; i < _capacity; i++)
+							if (_ctrl[i] >= 0)
+								_alloc.destroy(_slots + i);
+					_ctrl_alloc.deallocate(_ctrl, _capacity + 1);
+					_alloc.deallocate(_slots, _capacity);
+				}
+				_ctrl = ctrl;
+				_slots = slots;
+				_capacity = cap;
+				_growth_left = limit(cap, _max_load) - _size;
+			}
+
+			// back to no slots at all
+			void release()
+			{
+				if (_capacity == 0)
+					return ;
+				clear();
+				_ctrl_alloc.deallocate(_ctrl, _capacity + 1);
+				_alloc.deallocate(_slots, _capacity);
+				_ctrl = no_slots();
+				_slots = 0;
+				_capacity = 0;
+				_growth_left = 0;
+			}
+
+			// destroys the elements built in the first n slots of a failed copy, then frees it
+			void free_slots(signed char* ctrl, T* slots, std::size_t n, std::size_t cap)
+			{
+				if (slots != 0)
+				{
+					for (std::size_t i = 0; i < n; i++)
+						if (ctrl[i] >= 0)
+							_alloc.destroy(slots + i);
+					_alloc.deallocate(slots, cap);
+				}
+				_ctrl_alloc.deallocate(ctrl, cap + 1);
+			}
+	};
+};
+
+#endif
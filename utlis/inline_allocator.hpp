@@ -0,0 +1,107 @@
+#ifndef INLINE_ALLOCATOR_HPP
+#define INLINE_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace ft
+{
+	/*****************************************	inline_allocator	*****************************************
+	* Allocator with room for N elements inside itself, used by ft::small_vector.
+	* A request for at most N elements gets the inline buffer while it is free, anything else goes to Alloc.
+	* deallocate() tells the two apart by address, so heap blocks may be freed by any copy.
+	* Copies and assignment never copy the buffer: every instance starts with its own, unused.
+	*********************************************************************************************************/
+	template <class T, std::size_t N, class Alloc = std::allocator<T> >
+	class inline_allocator
+	{
+		public:
+			typedef typename Alloc::value_type			value_type;
+			typedef typename Alloc::pointer				pointer;
+			typedef typename Alloc::const_pointer		const_pointer;
+			typedef typename Alloc::reference			reference;
+			typedef typename Alloc::const_reference		const_reference;
+			typedef typename Alloc::size_type			size_type;
+			typedef typename Alloc::difference_type		difference_type;
+			typedef Alloc								heap_allocator;
+
+			static const std::size_t	inline_size = N;
+
+		private:
+			union storage
+			{
+#if __cplusplus >= 201103L
+				alignas(T) char	bytes[(N ? N : 1) * sizeof(T)];
+#else
+				char		bytes[(N ? N : 1) * sizeof(T)];
+#endif
+				long double	align_ld;
+				void*		align_p;
+				long long	align_ll;
+			};
+
+#if __cplusplus < 201103L
+			// no alignas: a T aligned beyond the members above (SSE/AVX types) is refused
+			template <class U>
+			struct alignment
+			{
+				struct probe	{	char c; U u;	};
+				static const std::size_t	value = sizeof(probe) - sizeof(U);
+			};
+			typedef char	requires_fundamental_alignment[(alignment<T>::value <= alignment<storage>::value) ? 1 : -1];
+#endif
+
+			Alloc	_heap;
+			bool	_used;
+			storage	_buf;
+
+		public:
+			explicit inline_allocator(const Alloc& alloc = Alloc()) : _heap(alloc), _used(false) {}
+			inline_allocator(const inline_allocator& x) : _heap(x._heap), _used(false) {}
+
+			inline_allocator& operator=(const inline_allocator& x)
+			{
+				_heap = x._heap;
+				return (*this);
+			}
+
+			pointer allocate(size_type n)
+			{
+				if (n <= N && !_used)
+				{
+					_used = true;
+					return (inline_buffer());
+				}
+				return (_heap.allocate(n));
+			}
+
+			void deallocate(pointer p, size_type n)
+			{
+				if (p == inline_buffer())
+					_used = false;
+				else if (p != 0)
+					_heap.deallocate(p, n);
+			}
+
+			bool is_inline(const_pointer p) const	{	return (p == inline_buffer());	}
+
+#if __cplusplus >= 201103L
+			template <class U, class... Args>
+			void construct(U* p, Args&&... args)			{	_heap.construct(p, std::forward<Args>(args)...);	}
+#else
+			void construct(pointer p, const_reference val)	{	_heap.construct(p, val);	}
+#endif
+			void destroy(pointer p)							{	_heap.destroy(p);			}
+
+			size_type max_size() const	{	return (_heap.max_size());	}
+
+			heap_allocator get_heap_allocator() const	{	return (_heap);	}
+
+		private:
+			pointer inline_buffer()				{	return (reinterpret_cast<pointer>(_buf.bytes));	}
+			const_pointer inline_buffer() const	{	return (reinterpret_cast<const_pointer>(_buf.bytes));	}
+	};
+};
+
+#endif
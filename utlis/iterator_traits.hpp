@@ -63,6 +63,43 @@ namespace ft
 	struct bidirectional_iterator_tag : public forward_iterator_tag       {};
 	struct random_access_iterator_tag : public bidirectional_iterator_tag {};
 
+	/*******************	DISTANCE	********************
+	* O(1) for random access iterators (std or ft tagged),
+	* a walk for everything else
+	************************************************************/
+	template <class It>
+	typename ft::iterator_traits<It>::difference_type distance_tag(It first, It last, std::input_iterator_tag)
+	{
+		typename ft::iterator_traits<It>::difference_type n = 0;
+		for (; first != last; ++first)
+			n++;
+		return (n);
+	}
+
+	template <class It>
+	typename ft::iterator_traits<It>::difference_type distance_tag(It first, It last, ft::input_iterator_tag)
+	{
+		return (distance_tag(first, last, std::input_iterator_tag()));
+	}
+
+	template <class It>
+	typename ft::iterator_traits<It>::difference_type distance_tag(It first, It last, std::random_access_iterator_tag)
+	{
+		return (last - first);
+	}
+
+	template <class It>
+	typename ft::iterator_traits<It>::difference_type distance_tag(It first, It last, ft::random_access_iterator_tag)
+	{
+		return (last - first);
+	}
+
+	template <class It>
+	typename ft::iterator_traits<It>::difference_type distance(It first, It last)
+	{
+		return (distance_tag(first, last, typename ft::iterator_traits<It>::iterator_category()));
+	}
+
 	 template <class T>
   struct bidirectional_iterator : iterator<std::bidirectional_iterator_tag, T>
   {
@@ -0,0 +1,32 @@
+#ifndef KEY_EXTRACT_HPP
+#define KEY_EXTRACT_HPP
+
+namespace ft
+{
+	/*********************************************
+	* how ft::AVL finds the key inside a value:
+	* select_first	maps and multimaps, the key is .first
+	* identity		sets and multisets, the value is the key
+	* mapped_type is what operator[] / try_emplace
+	* build next to a key (void for sets)
+	*********************************************/
+	template <class Pair>
+	struct select_first
+	{
+		typedef typename Pair::first_type	key_type;
+		typedef typename Pair::second_type	mapped_type;
+
+		const key_type& operator()(const Pair& x) const	{	return (x.first);	}
+	};
+
+	template <class T>
+	struct identity
+	{
+		typedef T		key_type;
+		typedef void	mapped_type;
+
+		const T& operator()(const T& x) const	{	return (x);	}
+	};
+};
+
+#endif
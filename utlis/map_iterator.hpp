@@ -25,12 +25,13 @@ namespace ft
 
         private :
             Node*             _ptr;
-            const tree       *_tree;
+            Node*             _end;     // the tree's header, it moves with the nodes on swap
             Compare           _cmp;
 
         public :
-            map_iterator() : _ptr(), _tree(), _cmp() {}
-            map_iterator(Node* node, const tree *t) : _ptr(node), _tree(t) {}
+            map_iterator() : _ptr(), _end(), _cmp() {}
+            map_iterator(Node* node, const tree *t) : _ptr(node), _end(t->header()) {}
+            map_iterator(Node* node, Node* end) : _ptr(node), _end(end) {}
             map_iterator(const map_iterator<T, Node, Compare, tree> &x)
             {
                 *this = x;
@@ -41,7 +42,7 @@ namespace ft
             map_iterator &operator=(map_iterator const& x)
             {
                 _ptr = x._ptr;
-                _tree = x._tree;
+                _end = x._end;
                 _cmp = x._cmp;
                 return (*this);
             }
@@ -51,23 +52,28 @@ namespace ft
                 return (_ptr);
             }
 
-            T* operator->() const   {   return (_ptr->_data);    }
-            T& operator*() const    {   return (*_ptr->_data);   }
+            Node* header() const
+            {
+                return (_end);
+            }
+
+            T* operator->() const   {   return (&_ptr->_data);   }
+            T& operator*() const    {   return (_ptr->_data);    }
 
             operator map_iterator<const T, const Node, Compare, tree>() const
             {
-                return map_iterator<const T, const Node, Compare, tree>(_ptr, _tree);
+                return map_iterator<const T, const Node, Compare, tree>(_ptr, _end);
             }
 
             
+            /*********************************************
+            * plain in-order step through the parent links.
+            * the root has no parent, so running off the top
+            * means we were on the last node: go to the header
+            *********************************************/
             map_iterator& operator++()
             {
-				// std::cout << "error may be here \n";
                 Node* p;
-                if (_ptr == 0)
-                    return (*this = map_iterator(_tree->findmin(_tree->getRoot()), _tree));
-                if (_ptr == _tree->findmax(_tree->getRoot()))
-                    return (*this = map_iterator(0, _tree));
                 if (_ptr->right != 0)
                 {
                     _ptr = _ptr->right;
@@ -82,7 +88,7 @@ namespace ft
                         _ptr = p;
                         p = p->parent;
                     }
-                    _ptr = p;
+                    _ptr = (p != 0) ? p : _end;
                 }
                 return (*this);
             }
@@ -92,11 +98,12 @@ namespace ft
                 ++(*this);
                 return (tmp);
             }
+            // the header keeps the rightmost node, so --end() is one hop
             map_iterator& operator--()
             {
                 Node* p;
-                if (_ptr == 0)
-                    _ptr = _tree->findmax(_tree->getRoot());
+                if (_ptr == _end)
+                    _ptr = _ptr->right;
                 else
                 {
                    if (_ptr->left != 0)
@@ -127,6 +134,22 @@ namespace ft
             friend bool	operator==(map_iterator const& lhs, map_iterator const& rhs) { return (lhs._ptr == rhs._ptr); }
             friend bool	operator!=(map_iterator const& lhs, map_iterator const& rhs) { return (lhs._ptr != rhs._ptr); }
     };
+
+    // O(log n) from the subtree sizes once the tree keeps them exact (see AVL::counting), a plain walk before that
+    template <class T, class Node, class Compare, class tree>
+    typename map_iterator<T, Node, Compare, tree>::difference_type
+    distance(map_iterator<T, Node, Compare, tree> first, map_iterator<T, Node, Compare, tree> last)
+    {
+        typedef typename map_iterator<T, Node, Compare, tree>::difference_type  difference_type;
+
+        if (first.header() != 0 && first.header()->bf != 0)
+            return (static_cast<difference_type>(tree::index(last.base())) - static_cast<difference_type>(tree::index(first.base())));
+
+        difference_type n = 0;
+        for (; first != last; ++first)
+            ++n;
+        return (n);
+    }
 };
 
 #endif
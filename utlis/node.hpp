@@ -5,38 +5,37 @@
 
 namespace ft
 {
+    /*********************************************
+    * the value lives inside the node: one allocation
+    * per element and the key sits next to the links.
+    * the tree allocates raw nodes and constructs
+    * _data in place, so these constructors are only
+    * for standalone use.
+    * an AVL tree of 2^31 nodes is less than 45 high,
+    * so bf and ht fit in a byte each and the subtree
+    * size takes the rest of the word they used to fill
+    *********************************************/
     template <class T>
     class AVLNODE
     {
         public :
-            int			bf;
-            int         ht;
-            T*          _data;
+            signed char	bf;
+            signed char ht;
+            int         sz;     // nodes in this subtree, itself included
             AVLNODE<T>* parent;
             AVLNODE<T>*	left;
             AVLNODE<T>*	right;
+            T           _data;
 
-            AVLNODE() : ht(0),_data(0), parent(0), left(0),  right(0) {}
-            AVLNODE(T data) : ht(0), _data(data), parent(0), left(0), right(0) {}
-            AVLNODE(const AVLNODE& x) : ht(x.ht), bf(x.bf), _data(x._data), parent(x.parent), left(x.left), right(x.right) {}
+            AVLNODE() : bf(0), ht(0), sz(1), parent(0), left(0),  right(0), _data() {}
+            AVLNODE(const T& data) : bf(0), ht(0), sz(1), parent(0), left(0), right(0), _data(data) {}
+            AVLNODE(const AVLNODE& x) : bf(x.bf), ht(x.ht), sz(x.sz), parent(x.parent), left(x.left), right(x.right), _data(x._data) {}
             ~AVLNODE() {}
-            AVLNODE& operator=(const AVLNODE& x)
-            {
-                bf = x.bf;
-                _data = x._data;
-                parent = x.parent;
-                left = x.left;
-                right = x.right;
-                ht = x.ht;
-                return (*this);
-            }
     };
     template<class T>
     bool  operator== (const AVLNODE<T>&lhs, const AVLNODE<T>&rhs)
     {
-        if (lhs->_data == 0 && rhs->_data == 0)
-            return true;
-        return (lhs->_data == rhs._data);
+        return (&lhs == &rhs);
     };
     template<class T>
     bool operator!=(const AVLNODE<T>&lhs, const AVLNODE<T>&rhs)
@@ -45,4 +44,4 @@ namespace ft
     };
 };
 
-#endif
\ No newline at end of file
+#endif
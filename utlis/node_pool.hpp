@@ -0,0 +1,119 @@
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+
+#include <cstddef>
+#include <algorithm>
+
+namespace ft
+{
+	/*********************************************	node_pool	*********************************************
+	* Slab of tree nodes carved out of chunks obtained through Alloc.
+	* A freed node goes on a free list and is handed out again before any new slot is used,
+	  so nothing goes back to Alloc until release(), which gives every chunk back at once.
+	* Chunks start small (per-request maps stay cheap) and double up to max_chunk slots.
+	* Slot 0 of every chunk is its header: parent links the previous chunk, sz holds the slot count.
+	* Free nodes are linked through their parent pointer.
+	**********************************************************************************************************/
+	template <class Node, class Alloc>
+	class node_pool
+	{
+		public:
+			typedef Alloc			allocator_type;
+			typedef std::size_t		size_type;
+
+			static const size_type	first_chunk = 8;
+			static const size_type	max_chunk	= 1024;
+
+		private:
+			allocator_type	_alloc;
+			Node*			_chunks;	// header of the newest chunk
+			Node*			_free;		// nodes given back by deallocate
+			Node*			_next;		// first never used slot of the newest chunk
+			Node*			_end;
+			size_type		_chunk_n;	// slots in the next chunk
+
+			node_pool(const node_pool&);
+			node_pool& operator=(const node_pool&);
+
+		public:
+			explicit node_pool(const allocator_type& alloc = allocator_type()) : _alloc(alloc), _chunks(0), _free(0), _next(0), _end(0), _chunk_n(first_chunk) {}
+
+			~node_pool()	{	release();	}
+
+			// raw storage for one node, nothing is constructed
+			Node* allocate()
+			{
+				Node* node;
+
+				if (_free != 0)
+				{
+					node = _free;
+					_free = _free->parent;
+					return (node);
+				}
+				if (_next == _end)
+				{
+					grow(_chunk_n);
+					if (_chunk_n < max_chunk)
+						_chunk_n *= 2;
+				}
+				return (_next++);
+			}
+
+			// make sure the next n allocate() calls come from one chunk
+			void reserve(size_type n)
+			{
+				if (static_cast<size_type>(_end - _next) < n)
+					grow(n);
+			}
+
+			void deallocate(Node* node)
+			{
+				node->parent = _free;
+				_free = node;
+			}
+
+			// every node handed out is invalid afterwards
+			void release()
+			{
+				while (_chunks != 0)
+				{
+					Node* prev = _chunks->parent;
+					_alloc.deallocate(_chunks, static_cast<size_type>(_chunks->sz));
+					_chunks = prev;
+				}
+				_free		= 0;
+				_next		= 0;
+				_end		= 0;
+				_chunk_n	= first_chunk;
+			}
+
+			void swap(node_pool& x)
+			{
+				std::swap(_alloc, x._alloc);
+				std::swap(_chunks, x._chunks);
+				std::swap(_free, x._free);
+				std::swap(_next, x._next);
+				std::swap(_end, x._end);
+				std::swap(_chunk_n, x._chunk_n);
+			}
+
+			allocator_type get_allocator() const	{	return (_alloc);				}
+			size_type max_size() const				{	return (_alloc.max_size());		}
+
+		private:
+			// unused slots of the previous chunk stay idle until release()
+			void grow(size_type n)
+			{
+				Node* chunk = _alloc.allocate(n + 1);
+
+				chunk->parent	= _chunks;
+				chunk->sz		= static_cast<int>(n + 1);
+				_chunks			= chunk;
+				_next			= chunk + 1;
+				_end			= chunk + n + 1;
+			}
+	};
+};
+
+#endif
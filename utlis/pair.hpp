@@ -2,6 +2,9 @@
 #define PAIR_HPP
 
 #include <utility>
+#if __cplusplus >= 201103L
+# include <type_traits>
+#endif
 
 namespace ft
 {
@@ -29,6 +32,24 @@ namespace ft
 				this->second = pr.second;
 				return (*this);
 			}
+
+#if __cplusplus >= 201103L
+			// C++11: members are moved and forwarded instead of copied
+			pair(const pair&) = default;
+			pair(pair&&) = default;
+
+			template<class U, class V>
+			pair (U&& a, V&& b) : first(std::forward<U>(a)), second(std::forward<V>(b)) {}
+
+			template<class U, class V>
+			pair (pair<U,V>&& pr) : first(std::forward<U>(pr.first)), second(std::forward<V>(pr.second)) {}
+
+			pair& operator= (pair&& pr) noexcept(std::is_nothrow_move_assignable<T1>::value && std::is_nothrow_move_assignable<T2>::value){
+				this->first = std::move(pr.first);
+				this->second = std::move(pr.second);
+				return (*this);
+			}
+#endif
 	};
 
 	// Non-member functions
@@ -62,11 +83,19 @@ namespace ft
 		return !(lhs<rhs);
 	}
 
+#if __cplusplus >= 201103L
+	template <class T1, class T2> 
+	pair<typename std::decay<T1>::type, typename std::decay<T2>::type> make_pair (T1&& x, T2&& y)
+	{
+		return (pair<typename std::decay<T1>::type, typename std::decay<T2>::type>(std::forward<T1>(x), std::forward<T2>(y)));
+	}
+#else
 	template <class T1, class T2> 
 	pair<T1, T2> make_pair (T1 x, T2 y)
 	{
 		return (pair<T1, T2>(x, y));
 	}
+#endif
 };
 
 
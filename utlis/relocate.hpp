@@ -0,0 +1,112 @@
+#ifndef RELOCATE_HPP
+#define RELOCATE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include "type_traits.hpp"
+#include "pair.hpp"
+
+// moves in a C++11 build, plain copies in C++98
+#if __cplusplus >= 201103L
+# define FT_MOVE(x)	std::move(x)
+#else
+# define FT_MOVE(x)	(x)
+#endif
+
+namespace ft
+{
+	template <class T1, class T2>
+	struct is_trivially_relocatable<ft::pair<T1, T2> >
+	{
+		static const bool value = is_trivially_relocatable<T1>::value && is_trivially_relocatable<T2>::value;
+	};
+
+	/*****************************		uninitialized_relocate	*****************************
+	* Moves [first, last) into the raw storage at dest, which must not overlap it.
+	* Afterwards the source is raw storage again: nothing is left to destroy there.
+	* Trivially relocatable types are a single memcpy. Others are copy constructed (moved
+	  in a C++11 build, when that can't throw) and then destroyed; if a construction
+	  throws, what was built at dest is destroyed and the source is left untouched.
+	* Returns the end of the relocated range.
+	*****************************************************************************************/
+	template <class Alloc, class T>
+	T* uninitialized_relocate(Alloc& alloc, T* first, T* last, T* dest, typename ft::enable_if<ft::is_trivially_relocatable<T>::value>::type* = 0)
+	{
+		(void)alloc;
+		if (first != last)
+			std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof(T));
+		return (dest + (last - first));
+	}
+
+	template <class Alloc, class T>
+	T* uninitialized_relocate(Alloc& alloc, T* first, T* last, T* dest, typename ft::enable_if<!ft::is_trivially_relocatable<T>::value>::type* = 0)
+	{
+		T* cur = dest;
+
+		try
+		{
+			for (T* it = first; it != last; ++it, ++cur)
+#if __cplusplus >= 201103L
+				alloc.construct(cur, std::move_if_noexcept(*it));
+#else
+				alloc.construct(cur, *it);
+#endif
+		}
+		catch (...)
+		{
+			for (T* it = dest; it != cur; ++it)
+				alloc.destroy(it);
+			throw;
+		}
+		for (T* it = first; it != last; ++it)
+			alloc.destroy(it);
+		return (cur);
+	}
+
+	/*****************************	uninitialized_relocate_around	*************************
+	* Same as uninitialized_relocate, but the elements from split on land n slots further,
+	  leaving a hole of n raw slots at dest + (split - first) for the caller to fill.
+	* The source is only destroyed once every element has been built at dest.
+	*****************************************************************************************/
+	template <class Alloc, class T>
+	void uninitialized_relocate_around(Alloc& alloc, T* first, T* split, T* last, T* dest, std::size_t n, typename ft::enable_if<ft::is_trivially_relocatable<T>::value>::type* = 0)
+	{
+		(void)alloc;
+		if (first != split)
+			std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), (split - first) * sizeof(T));
+		if (split != last)
+			std::memcpy(static_cast<void*>(dest + (split - first) + n), static_cast<const void*>(split), (last - split) * sizeof(T));
+	}
+
+	template <class Alloc, class T>
+	void uninitialized_relocate_around(Alloc& alloc, T* first, T* split, T* last, T* dest, std::size_t n, typename ft::enable_if<!ft::is_trivially_relocatable<T>::value>::type* = 0)
+	{
+		T* it = first;
+		T* cur = dest;
+
+		try
+		{
+			for (; it != last; ++it, ++cur)
+			{
+				if (it == split)
+					cur += n;
+#if __cplusplus >= 201103L
+				alloc.construct(cur, std::move_if_noexcept(*it));
+#else
+				alloc.construct(cur, *it);
+#endif
+			}
+		}
+		catch (...)
+		{
+			for (T* built = first; built != it; ++built)
+				alloc.destroy(dest + (built - first) + ((built < split) ? 0 : n));
+			throw;
+		}
+		for (it = first; it != last; ++it)
+			alloc.destroy(it);
+	}
+};
+
+#endif
@@ -23,6 +23,11 @@ namespace ft
 		private: 
 			iterator_type    _it;
 
+			template <class It>
+			static pointer arrow(const It& it)	{	return (it.operator->());	}
+			template <class T>
+			static pointer arrow(T* p)			{	return (p);					}
+
 		public:
 			reverse_iterator()								: _it()		{}
 			reverse_iterator(iterator_type x)				: _it(x)	{}
@@ -45,8 +50,10 @@ namespace ft
 				return *(--temp);
 			}
 
+			// asks the iterator itself, whose operator* may return a proxy (see flat_map_iterator.hpp)
 			pointer operator->() const{
-				return &(operator*());
+				iterator_type temp = _it;
+				return arrow(--temp);
 			}
 
 			reverse_iterator &operator++() {
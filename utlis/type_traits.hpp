@@ -52,6 +52,60 @@ namespace ft
 
 	template <>
 	struct is_integral<unsigned long long>{		static const bool value = true;		};
+
+	template <class T>
+	struct remove_const				{		typedef T type;		};
+
+	template <class T>
+	struct remove_const<const T>	{		typedef T type;		};
+
+	template <class T, class U>
+	struct is_same			{		static const bool value = false;	};
+
+	template <class T>
+	struct is_same<T, T>	{		static const bool value = true;		};
+
+	/*****************	is_trivially_destructible	*****************
+	* no way to ask in C++98, so use the compiler builtin when there is one
+	* and only trust integral types otherwise
+	*********************************************************************/
+	template <class T>
+	struct is_trivially_destructible
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		static const bool value = __has_trivial_destructor(T);
+#else
+		static const bool value = is_integral<T>::value;
+#endif
+	};
+
+	/*****************	is_trivially_copyable	*****************
+	* safe to copy with memcpy; same builtin fallback as above
+	*********************************************************************/
+	template <class T>
+	struct is_trivially_copyable
+	{
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+		static const bool value = __is_trivially_copyable(T);
+#else
+		static const bool value = is_integral<T>::value;
+#endif
+	};
+
+	template <class T>
+	struct is_trivially_copyable<T*>	{		static const bool value = true;		};
+
+	/*****************	is_trivially_relocatable	*****************
+	* moving the bytes to a new address and forgetting the old ones is
+	  the same as copy construct + destroy. true for trivially copyable
+	  types; specialize it for types that only own heap memory through
+	  pointers (never for types that point into themselves)
+	*********************************************************************/
+	template <class T>
+	struct is_trivially_relocatable
+	{
+		static const bool value = is_trivially_copyable<T>::value;
+	};
 };
 
 #endif
\ No newline at end of file
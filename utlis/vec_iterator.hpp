@@ -24,6 +24,7 @@ namespace ft
 			// constructors and destructor
 			vec_iterator(void) 					: _it()		{};
 			vec_iterator(pointer it) 			: _it(it)	{};
+			vec_iterator(const vec_iterator& it) : _it(it._it)	{};
 			template <class T>
 			vec_iterator(const vec_iterator<T>& it):_it(it.base()){};
 			~vec_iterator(void) {};